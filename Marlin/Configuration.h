@@ -981,6 +981,10 @@
 // and processor overload (too many expensive sqrt calls).
 #define DEFAULT_SEGMENTS_PER_SECOND 200
 
+// Compute the tower positions of this many segments in one pass.
+// Lets FPU-equipped 32-bit boards sustain a higher segment rate.
+// #define DELTA_IK_BATCH 8
+
 // After homing move down to a height where XY movement is unconstrained
 // #define DELTA_HOME_TO_SAFE_ZONE
 
@@ -1238,6 +1242,18 @@
  */
 // #define ENDSTOP_NOISE_THRESHOLD 2
 
+/**
+ * Endstop Edge Capture
+ *
+ * Latch the stepper positions the moment an endstop or probe pin changes
+ * state, instead of when the trigger is finally acted upon. Homing reports
+ * and probe measurements then exclude the steps taken during debouncing
+ * and polling delays, allowing faster probing without losing accuracy.
+ * Only endstops on the moving axes are latched.
+ * Requires ENDSTOP_INTERRUPTS_FEATURE. Most effective with ENDSTOP_NOISE_THRESHOLD.
+ */
+// #define ENDSTOP_EDGE_CAPTURE
+
 // Check for stuck or disconnected endstops during homing moves.
 // #define DETECT_BROKEN_ENDSTOP
 
@@ -2086,6 +2102,13 @@
  */
 // #define BD_SENSOR
 
+/**
+ * Scan each row of the G29 bilinear grid in a single move, reading the
+ * bed distance sensor on the fly instead of stopping at every point.
+ * Requires BD_SENSOR. Contact probes must stop and descend at each point.
+ */
+// #define FAST_MESH_SCAN
+
 /**
  * Enable detailed logging of G28, G29, M48, etc.
  * Turn on with the command 'M111 S32'.
@@ -2158,6 +2181,24 @@
 #define BILINEAR_SUBDIVISIONS 3
 #endif
 
+//
+// Precompute the bilinear patch of every grid cell when the mesh changes.
+// Each leveled segment then costs one cell lookup and three multiply-adds.
+// Uses 16 bytes of RAM per (subdivided) grid cell.
+//
+// #define ABL_BILINEAR_CELL_CACHE
+
+//
+// Adaptive probing with 'G29 K'. A coarse lattice of the grid is probed first,
+// then only cells whose center (or a point probed on an edge) departs from the
+// bilinear estimate of its corners by more than the threshold are subdivided.
+// Points in flat cells are interpolated.
+//
+// #define G29_ADAPTIVE_MESH
+#if ENABLED(G29_ADAPTIVE_MESH)
+#define G29_ADAPTIVE_THRESHOLD 0.02 // (mm) Default residual for 'G29 K' without a value
+#endif
+
 #endif
 
 #elif ENABLED(AUTO_BED_LEVELING_UBL)
@@ -2390,6 +2431,22 @@
 #if ENABLED(EEPROM_SETTINGS)
 // #define EEPROM_AUTO_INIT  // Init EEPROM automatically on any errors.
 #define EEPROM_INIT_NOW // Init EEPROM on first boot after a new build.
+/**
+ * With FLASH_EEPROM_EMULATION on STM32F4, append only the changed bytes of
+ * each M500 to a journal in FLASH_SECTOR and the sector below it, instead of
+ * erasing and rewriting the whole image. A sector is erased only when the
+ * journal fills up. Takes the place of FLASH_EEPROM_LEVELING. Settings are
+ * not saved if the firmware image reaches into the lower sector.
+ */
+// #define FLASH_EEPROM_JOURNAL
+/**
+ * Keep the bed mesh (MBL or Bilinear) in its own section after the settings,
+ * with its own version, grid size, and CRC. Boot validates and applies only
+ * the settings proper, and the mesh is read when first used (leveling on,
+ * G29, M420, M421, M500, M503, or a mesh editor). Changes the EEPROM layout
+ * (reset on flash).
+ */
+// #define EEPROM_LAZY_LOAD
 #endif
 
 // @section host
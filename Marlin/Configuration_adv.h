@@ -1542,6 +1542,16 @@
   //#define SD_IGNORE_AT_STARTUP            // Don't mount the SD card when starting up
   //#define SDCARD_READONLY                 // Read-only SD card (to save over 2K of flash)
 
+  /**
+   * Buffer uploads (M28 and binary transfer) and write them to the media
+   * in pre-erased multi-block bursts instead of one block at a time.
+   * Benchmark with 'D101 S<chunk>' in MARLIN_DEV_MODE.
+   */
+  //#define SD_MULTIBLOCK_WRITE
+  #if ENABLED(SD_MULTIBLOCK_WRITE)
+    #define SD_WRITE_BUFFER_BLOCKS 4        // Blocks per burst (2-16). Costs 512 bytes of SRAM each.
+  #endif
+
   //#define GCODE_REPEAT_MARKERS            // Enable G-code M808 to set repeat markers and do looping
 
   #define SD_PROCEDURE_DEPTH 1              // Increase if you need more nested M32 calls
@@ -1592,6 +1602,13 @@
     // especially with "vase mode" printing. Set too high and vases cannot be continued.
     #define POWER_LOSS_MIN_Z_CHANGE 0 // (mm) Minimum Z change before saving power-loss data
 
+    // Keep the power-loss file as a preallocated journal written one SD block per save.
+    // Most saves only write the position, temperatures, etc. to the next block of a ring.
+    //#define POWER_LOSS_JOURNAL
+    #if ENABLED(POWER_LOSS_JOURNAL)
+      #define POWER_LOSS_JOURNAL_SIZE 16 // Blocks in the ring of saved states
+    #endif
+
     // Enable if Z homing is needed for proper recovery. 99.9% of the time this should be disabled!
     //#define POWER_LOSS_RECOVER_ZHOME
     #if ENABLED(POWER_LOSS_RECOVER_ZHOME)
@@ -1635,6 +1652,13 @@
     #define SDSORT_DYNAMIC_RAM false  // Use dynamic allocation (within SD menus). Least expensive option. Set SDSORT_LIMIT before use!
     #define SDSORT_CACHE_VFATS 2      // Maximum number of 13-byte VFAT entries to use for sorting.
                                       // Note: Only affects SCROLL_LONG_FILENAMES with SDSORT_CACHE_NAMES but not SDSORT_DYNAMIC_RAM.
+    //#define SDSORT_BACKGROUND               // Index and sort the directory from idle() in short slices. Menus show the items sorted so far.
+    #if ENABLED(SDSORT_BACKGROUND)
+      #define SDSORT_KEY_LEN   16             // Leading name characters used as the sort key. Costs 1 byte each per item.
+      #define SDSORT_SLICE_MS   5             // Maximum time (ms) spent indexing per idle() call
+      //#define SDSORT_FILE_INDEX               // Keep each folder's sorted listing in a MARLIN.IDX file for instant browsing.
+                                              // It's checked against the folder entries and rebuilt in the background when stale.
+    #endif
   #endif
 
   // Allow international symbols in long filenames. To display correctly, the
@@ -1644,6 +1668,8 @@
   #define LONG_FILENAME_HOST_SUPPORT    // Get the long filename of a file/folder with 'M33 <dosname>' and list long filenames with 'M20 L'
   #define LONG_FILENAME_WRITE_SUPPORT   // Create / delete files with long filenames via M28, M30, and Binary Transfer Protocol
   //#define M20_TIMESTAMP_SUPPORT         // Include timestamps by adding the 'T' flag to M20 commands
+  //#define M20_PAGED_LISTING             // Page M20 output with 'S<offset> C<count>', compact it with 'H',
+                                          // and skip unchanged listings with 'K<token>'
 
   #define SCROLL_LONG_FILENAMES         // Scroll long filenames in the SD card menu
 
@@ -1737,6 +1763,20 @@
     //#define CUSTOM_FIRMWARE_UPLOAD
   #endif
 
+  /**
+   * Print heatshrink-compressed G-code (*.HS) directly from the media,
+   * decompressing it as it is read. G-code typically compresses 3-5x.
+   * Compress on the host with the window and lookahead given below, e.g.:
+   *   heatshrink -e -w 10 -l 4 part.gcode part.gcode.hs
+   * A compressed BINARY_FILE_TRANSFER upload to a *.HS name is stored as-is.
+   */
+  //#define SDCARD_COMPRESSED_PRINT
+  #if ENABLED(SDCARD_COMPRESSED_PRINT)
+    #define HEATSHRINK_WINDOW_BITS    10  // Decoder window is 2^N bytes of RAM. Must match the compressor (-w).
+    #define HEATSHRINK_LOOKAHEAD_BITS  4  // Must match the compressor (-l).
+                                          // BINARY_FILE_TRANSFER reports these to the host. Otherwise it uses 8 and 4.
+  #endif
+
   /**
    * Set this option to one of the following (or the board's defaults apply):
    *
@@ -2037,6 +2077,30 @@
   //#define TFT_BTOKMENU_COLOR 0x145F // 00010 100010 11111 Cyan
 #endif
 
+//
+// Color UI Options
+//
+#if ENABLED(TFT_COLOR_UI)
+  /**
+   * Remember what was last drawn in each area of the screen and skip
+   * redrawing areas that haven't changed, so a status refresh only renders
+   * and sends the widgets that changed. With MARLIN_DEV_MODE, 'D11' reports
+   * the bytes sent to the display.
+   */
+  //#define TFT_DIRTY_RECTS
+  #if ENABLED(TFT_DIRTY_RECTS)
+    #define TFT_DIRTY_RECTS_MAX 24  // Number of areas to remember (12 bytes each)
+  #endif
+
+  /**
+   * Split the TFT buffer in two, so a canvas draws its next slice into one
+   * half while DMA sends the other half to the display. Each idle() draws at
+   * most one half-buffer slice, which bounds the time the UI takes from the
+   * main loop. Requires a TFT_BUFFER_SIZE of at least two display lines.
+   */
+  //#define TFT_DOUBLE_BUFFER
+#endif
+
 //
 // ADC Button Debounce
 //
@@ -2194,8 +2258,9 @@
   //#define MESH_MAX_Y Y_BED_SIZE - (MESH_INSET)
 #endif
 
-#if BOTH(AUTO_BED_LEVELING_UBL, EEPROM_SETTINGS)
-  //#define OPTIMIZED_MESH_STORAGE  // Store mesh with less precision to save EEPROM space
+#if BOTH(AUTO_BED_LEVELING_UBL, EEPROM_SETTINGS) || ENABLED(ABL_BILINEAR_SUBDIVISION)
+  //#define OPTIMIZED_MESH_STORAGE  // Store meshes as 16-bit µm offsets from their mean plane. Halves the
+                                    // size of UBL mesh slots in EEPROM and the subdivided bilinear grid in RAM.
 #endif
 
 /**
@@ -2301,6 +2366,28 @@
   #define N_ARC_CORRECTION       25   // Number of interpolated segments between corrections
   //#define ARC_P_CIRCLES             // Enable the 'P' parameter to specify complete circles
   //#define SF_ARC_FIX                // Enable only if using SkeinForge with "Arc Point" fillet procedure
+
+  /**
+   * Plan XY arcs as curved blocks instead of chords. The stepper follows the
+   * circle directly, so a G2/G3 needs only a few blocks (split wherever a motor
+   * reverses) and has no chord corners to slow down for.
+   */
+  //#define ARC_NATIVE_BLOCKS
+  #if ENABLED(ARC_NATIVE_BLOCKS)
+    #define ARC_NATIVE_SEGMENT_MM  10   // (mm) Longest arc block, so leveling still follows the arc
+  #endif
+
+  /**
+   * G64 Path Blending
+   * G64 P<mm> replaces each corner between two XY moves with an arc that stays
+   * within P of the programmed corner, so the toolhead no longer has to slow
+   * down for every vertex of a polyline. G64 P0 restores the exact path.
+   * The last G0/G1 is held back until the next move shows the corner to blend.
+   */
+  //#define PATH_BLENDING
+  #if ENABLED(PATH_BLENDING)
+    #define PATH_BLENDING_TOLERANCE 0.05  // (mm) Corner tolerance for G64 without P
+  #endif
 #endif
 
 // G5 Bézier Curve Support with XYZE destination and IJPQ offsets
@@ -2336,6 +2423,30 @@
 // Moves (or segments) with fewer steps than this will be joined with the next move
 #define MIN_STEPS_PER_SEGMENT 6
 
+/**
+ * Adaptive kinematic segmentation
+ * Join the fixed DELTA / SCARA / POLARGRAPH segments wherever the joint paths are
+ * nearly straight. A segment is halved until the joints at its midpoint are within
+ * the tolerance of linear interpolation, down to the segments-per-second length.
+ * SCARA joint angles are scaled by the arm reach to get a distance at the effector.
+ */
+#if IS_KINEMATIC
+  //#define KINEMATIC_SEGMENT_TOLERANCE 10 // (µm)
+#endif
+
+/**
+ * Streaming segmentation
+ * Buffer the segments of DELTA / SCARA moves and SEGMENT_LEVELED_MOVES a few at a
+ * time from idle(), instead of holding up G-code processing until a long move is
+ * fully queued. Other moves and position changes wait for the stream to finish.
+ */
+#if IS_KINEMATIC || ENABLED(SEGMENT_LEVELED_MOVES)
+  //#define STREAMING_SEGMENTS
+  #if ENABLED(STREAMING_SEGMENTS)
+    #define STREAMING_SEGMENTS_PER_LOOP 4 // Segments to buffer on each idle()
+  #endif
+#endif
+
 /**
  * Minimum delay before and after setting the stepper DIR (in ns)
  *     0 : No delay (Expect at least 10µS since one Stepper ISR must transpire)
@@ -2570,6 +2681,19 @@
    */
   //#define TOOL_SENSOR
 
+  /**
+   * Preheat the next tool before its tool-change.
+   * Look ahead in the command queue and (when printing from SD) in the G-code
+   * file for the next T command. If the upcoming tool was turned off it is heated
+   * back to the target it had when last deselected, so it's up to temperature
+   * when it takes over.
+   */
+  //#define TOOLCHANGE_PREHEAT
+  #if ENABLED(TOOLCHANGE_PREHEAT)
+    #define TOOLCHANGE_PREHEAT_LOOKAHEAD 16384 // (bytes) How far ahead to scan the SD file
+    //#define TOOLCHANGE_PREHEAT_STANDBY       // Also raise a tool left at a standby temperature. Overrides slicer ooze control.
+  #endif
+
   /**
    * Retract and prime filament on tool-change to reduce
    * ooze and stringing and to get cleaner transitions.
@@ -3467,6 +3591,30 @@
      */
     //#define LASER_POWER_TRAP
 
+    /**
+     * Scale the laser's power by the instantaneous speed in the Stepper ISR.
+     *
+     * - Uses the same step rate that times the steps, so it also follows S-curve acceleration.
+     * - Costs one multiply per ISR. The PWM is only updated when the power changes.
+     * - With input shaping the power follows the unshaped (commanded) speed.
+     */
+    //#define LASER_POWER_VELOCITY
+
+    /**
+     * G7 raster engraving in continuous inline mode (M3 I).
+     * One G7 move carries a run of pixel powers that the Stepper ISR applies
+     * one pixel pitch at a time, so a scan line is a few commands instead of
+     * a G1 per pixel.
+     *
+     * e.g., 'G7 X20 F6000 S100 $AIBA/w' - Pixels 0-255 (base64, must be last) scale the S power.
+     *
+     * Raise MAX_CMD_SIZE to send more pixels in each G7.
+     */
+    //#define LASER_RASTER
+    #if ENABLED(LASER_RASTER)
+      #define LASER_RASTER_PIXELS  64 // Most pixels in one G7. Adds this many bytes to every planner block.
+    #endif
+
     //
     // Laser I2C Ammeter (High precision INA226 low/high side module)
     //
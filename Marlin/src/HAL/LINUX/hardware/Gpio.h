@@ -81,9 +81,10 @@ public:
     set(pin, 1);
   }
 
-  static void set(pin_type pin, uint16_t value) {
+  // analogWrite always reports SET_VALUE so that 0 and 1 read as PWM levels, not LOW/HIGH
+  static void set(pin_type pin, uint16_t value, const bool analog=false) {
     if (!valid_pin(pin)) return;
-    GpioEvent::Type evt_type = value > 1 ? GpioEvent::SET_VALUE : value > pin_map[pin].value ? GpioEvent::RISE : value < pin_map[pin].value ? GpioEvent::FALL : GpioEvent::NOP;
+    GpioEvent::Type evt_type = (analog || value > 1) ? GpioEvent::SET_VALUE : value > pin_map[pin].value ? GpioEvent::RISE : value < pin_map[pin].value ? GpioEvent::FALL : GpioEvent::NOP;
     pin_map[pin].value = value;
     GpioEvent evt(Clock::nanos(), pin, evt_type);
     if (pin_map[pin].cb) {
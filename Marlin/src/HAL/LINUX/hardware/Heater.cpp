@@ -22,35 +22,121 @@
 #ifdef __PLAT_LINUX__
 
 #include "Clock.h"
-#include <stdio.h>
+#include <math.h>
 #include "../../../inc/MarlinConfig.h"
 
 #include "Heater.h"
 
-Heater::Heater(pin_t heater, pin_t adc) {
-  heater_state = 0;
-  room_temp_raw = 150;
-  last = Clock::micros();
-  heater_pin = heater;
-  adc_pin = adc;
-  heat = 0.0;
+PwmInput::PwmInput(pin_type pin) : pin(pin) {
+  on_time = 0;
+  level = 0;
+  level_since = last_sample = Clock::nanos();
+  last_on_time = 0;
+  Gpio::attachPeripheral(pin, this);
+}
+
+PwmInput::~PwmInput() {
+}
+
+void PwmInput::interrupt(GpioEvent ev) {
+  if (ev.pin_id != pin || ev.event == GpioEvent::SETM || ev.event == GpioEvent::SETD) return;
+  // Credit the time spent at the previous level, then latch the new one
+  on_time += (ev.timestamp - level_since) * level / 255;
+  level_since = ev.timestamp;
+  const uint16_t value = Gpio::pin_map[pin].value;
+  level = ev.event == GpioEvent::SET_VALUE ? _MIN(value, 255) : value * 255;
+}
+
+double PwmInput::duty() {
+  const uint64_t now = Clock::nanos(), since = level_since,
+                 total = on_time + (now > since ? (now - since) * level / 255 : 0);
+  const double d = now > last_sample ? double(total - last_on_time) / (now - last_sample) : 0.0;
+  last_on_time = total;
+  last_sample = now;
+  return constrain(d, 0.0, 1.0);
+}
+
+Heater::Heater(pin_type heater, pin_type adc, const heater_sim_t &params,
+               const temp_entry_t *table/*=nullptr*/, const uint8_t table_len/*=0*/,
+               PwmInput *fan/*=nullptr*/, const LinearAxis *extruder/*=nullptr*/, const double e_steps_per_mm/*=0*/)
+  : heater_pin(heater), adc_pin(adc), params(params), pwm(heater), fan(fan),
+    table(table), table_len(table_len), extruder(extruder), e_steps_per_mm(e_steps_per_mm)
+{
+  temperature = sensor_temperature = SIM_AMBIENT_TEMP;
+  last_e_position = extruder ? extruder->position : 0;
+  last = Clock::nanos();
+  Gpio::pin_map[analogInputToDigitalPin(adc_pin)].value = celsius_to_adc(sensor_temperature) << 2;
 }
 
 Heater::~Heater() {
 }
 
+/**
+ * Reverse lookup of the firmware thermistor table, so the simulated sensor
+ * reads back exactly as the configured sensor would. Without a table fall
+ * back to an ideal 100k / B4092 NTC with a 4.7k pull-up.
+ */
+uint16_t Heater::celsius_to_adc(const double celsius) {
+  double adc;
+  if (table && table_len > 1) {
+    auto raw_at = [&](const uint8_t i) { return double(pgm_read_word(&table[i].value)) / (OVERSAMPLENR) / (THERMISTOR_TABLE_SCALE); };
+    auto c_at = [&](const uint8_t i) { return double(int16_t(pgm_read_word(&table[i].celsius))); };
+    // Tables are sorted by raw value, so temperature runs in one direction only
+    const bool rising = c_at(table_len - 1) > c_at(0);
+    const uint8_t lo = rising ? 0 : table_len - 1, hi = rising ? table_len - 1 : 0;
+    if (celsius <= c_at(lo)) adc = raw_at(lo);
+    else if (celsius >= c_at(hi)) adc = raw_at(hi);
+    else {
+      uint8_t i = 1;
+      while (i < table_len - 1 && !WITHIN(celsius, _MIN(c_at(i - 1), c_at(i)), _MAX(c_at(i - 1), c_at(i)))) i++;
+      const double c0 = c_at(i - 1), c1 = c_at(i);
+      adc = raw_at(i - 1) + (raw_at(i) - raw_at(i - 1)) * (c1 != c0 ? (celsius - c0) / (c1 - c0) : 0.0);
+    }
+  }
+  else {
+    const double r = 100000.0 * exp(4092.0 * (1.0 / (celsius + 273.15) - 1.0 / 298.15));
+    adc = 1023.0 * r / (r + 4700.0);
+  }
+  return uint16_t(constrain(adc + 0.5, 0.0, 1023.0));
+}
+
 void Heater::update() {
-  // crude pwm read and cruder heat simulation
-  auto now = Clock::micros();
-  double delta = (now - last);
-  if (delta > 1000 ) {
-    heater_state = pwmcap.update(0xFFFF * Gpio::pin_map[heater_pin].value);
-    last = now;
-    heat += (heater_state - heat) * (delta / 1000000000.0);
-
-    NOLESS(heat, room_temp_raw);
-    Gpio::pin_map[analogInputToDigitalPin(adc_pin)].value = 0xFFFF - (uint16_t)heat;
+  const uint64_t now = Clock::nanos();
+  if (now - last < 1000000) return; // Step the plant at 1ms of simulated time at most
+
+  const double dt = (now - last) / 1000000000.0;
+  last = now;
+
+  const double duty = pwm.duty(), fan_duty = fan ? fan->duty() : 0.0;
+
+  // Filament pulled through the melt zone carries heat away
+  double e_speed = 0.0;
+  if (extruder && e_steps_per_mm > 0) {
+    const int32_t e_position = extruder->position;
+    e_speed = _MAX(e_position - last_e_position, 0) / e_steps_per_mm / dt;
+    last_e_position = e_position;
   }
+
+  const double loss = params.ambient_xfer + params.ambient_xfer_fan * fan_duty + params.filament_heat_capacity * e_speed,
+               power = params.heater_power * duty;
+
+  // Sub-step so the sensor lag sees the zone temperature change within the interval
+  for (double remaining = dt; remaining > 0; remaining -= 0.01) {
+    const double h = _MIN(remaining, 0.01);
+    if (loss > 0) {
+      // Exact solution for constant inputs over the step
+      const double settle = SIM_AMBIENT_TEMP + power / loss;
+      temperature = settle + (temperature - settle) * exp(-loss * h / params.heat_capacity);
+    }
+    else
+      temperature += power * h / params.heat_capacity;
+
+    sensor_temperature = params.sensor_lag > 0
+      ? sensor_temperature + (temperature - sensor_temperature) * (1.0 - exp(-h / params.sensor_lag))
+      : temperature;
+  }
+
+  Gpio::pin_map[analogInputToDigitalPin(adc_pin)].value = celsius_to_adc(sensor_temperature) << 2;
 }
 
 void Heater::interrupt(GpioEvent ev) {
@@ -21,27 +21,91 @@
  */
 #pragma once
 
+#include <atomic>
 #include "Gpio.h"
+#include "LinearAxis.h"
+#include "../../../module/thermistor/thermistors.h"
 
-struct LowpassFilter {
-  uint64_t data_delay = 0;
-  uint16_t update(uint16_t value) {
-    data_delay += value - (data_delay >> 6);
-    return uint16_t(data_delay >> 6);
-  }
+/**
+ * Simulated thermal plant parameters
+ * Override any of these with -D build flags to model a different machine.
+ *
+ *                          Power  Capacity  Ambient  Fan    Filament  Sensor
+ *                           (W)    (J/K)    (W/K)    (W/K)  (J/K/mm)   (s)
+ */
+#ifndef SIM_HOTEND_PARAMS
+  #define SIM_HOTEND_PARAMS { 40.0,   16.0,    0.07,    0.10,  0.0056,    1.5 }
+#endif
+#ifndef SIM_BED_PARAMS
+  #define SIM_BED_PARAMS    { 250.0,  800.0,   1.2,     0.05,  0.0,       4.0 }
+#endif
+#ifndef SIM_CHAMBER_PARAMS
+  #define SIM_CHAMBER_PARAMS { 200.0, 4000.0,  2.0,     0.0,   0.0,      10.0 }
+#endif
+#ifndef SIM_AMBIENT_TEMP
+  #define SIM_AMBIENT_TEMP 25.0 // (°C)
+#endif
+
+typedef struct {
+  double heater_power,            // (W) Heater power at 100% duty
+         heat_capacity,           // (J/K) Heat capacity of the heated mass
+         ambient_xfer,            // (W/K) Heat loss to ambient with the fan off
+         ambient_xfer_fan,        // (W/K) Additional heat loss to ambient with the fan at 100%
+         filament_heat_capacity,  // (J/K/mm) Heat carried away by each mm of extruded filament
+         sensor_lag;              // (s) Time constant of the temperature sensor
+} heater_sim_t;
+
+/**
+ * Average the duty cycle of an output pin, whether it is driven by
+ * soft PWM (digitalWrite 0/1) or by analogWrite (0-255).
+ */
+class PwmInput: public Peripheral {
+public:
+  PwmInput(pin_type pin);
+  virtual ~PwmInput();
+  void interrupt(GpioEvent ev);
+  void update() {}
+  double duty();  // Average duty cycle (0.0-1.0) since the previous call
+
+  pin_type pin;
+
+private:
+  // Written only by interrupt() so the simulation thread never blocks the firmware
+  std::atomic<uint64_t> on_time, level_since;
+  std::atomic<uint16_t> level;
+  uint64_t last_on_time, last_sample;
 };
 
+/**
+ * First-order lumped thermal model of one heater zone:
+ *
+ *   C * dT/dt = P * duty - (k_amb + k_fan * fan + c_fil * e_speed) * (T - T_amb)
+ *
+ * The sensor follows the zone temperature with a first-order lag and the
+ * result is written back to the ADC pin through the configured thermistor table.
+ */
 class Heater: public Peripheral {
 public:
-  Heater(pin_t heater, pin_t adc);
+  Heater(pin_type heater, pin_type adc, const heater_sim_t &params,
+         const temp_entry_t *table=nullptr, const uint8_t table_len=0,
+         PwmInput *fan=nullptr, const LinearAxis *extruder=nullptr, const double e_steps_per_mm=0);
   virtual ~Heater();
   void interrupt(GpioEvent ev);
   void update();
 
-  pin_t heater_pin, adc_pin;
-  uint16_t room_temp_raw;
-  uint16_t heater_state;
-  LowpassFilter pwmcap;
-  double heat;
+  pin_type heater_pin, adc_pin;
+  heater_sim_t params;
+  double temperature,         // (°C) Zone temperature
+         sensor_temperature;  // (°C) Temperature seen by the sensor
+
+private:
+  uint16_t celsius_to_adc(const double celsius);
+
+  PwmInput pwm, *fan;
+  const temp_entry_t *table;
+  uint8_t table_len;
+  const LinearAxis *extruder;
+  double e_steps_per_mm;
+  int32_t last_e_position;
   uint64_t last;
 };
@@ -24,6 +24,10 @@
 
 //#define GPIO_LOGGING // Full GPIO and Positional Logging
 
+#ifndef SIM_TIME_MULTIPLIER
+  #define SIM_TIME_MULTIPLIER 1.0 // Run the simulation faster than real time (e.g., 10.0 for thermal tuning)
+#endif
+
 #include "../../inc/MarlinConfig.h"
 #include "../shared/Delay.h"
 #include "hardware/IOLoggerCSV.h"
@@ -61,12 +65,45 @@ void read_serial_thread() {
 }
 
 void simulation_loop() {
-  Heater hotend(HEATER_0_PIN, TEMP_0_PIN);
-  Heater bed(HEATER_BED_PIN, TEMP_BED_PIN);
   LinearAxis x_axis(X_ENABLE_PIN, X_DIR_PIN, X_STEP_PIN, X_MIN_PIN, X_MAX_PIN);
   LinearAxis y_axis(Y_ENABLE_PIN, Y_DIR_PIN, Y_STEP_PIN, Y_MIN_PIN, Y_MAX_PIN);
   LinearAxis z_axis(Z_ENABLE_PIN, Z_DIR_PIN, Z_STEP_PIN, Z_MIN_PIN, Z_MAX_PIN);
-  LinearAxis extruder0(E0_ENABLE_PIN, E0_DIR_PIN, E0_STEP_PIN, P_NC, P_NC);
+  #define _SIM_EXTRUDER(N) { E##N##_ENABLE_PIN, E##N##_DIR_PIN, E##N##_STEP_PIN, P_NC, P_NC },
+  LinearAxis extruder[] = { REPEAT(E_STEPPERS, _SIM_EXTRUDER) };
+
+  // Thermal zones, built from the pin map
+  #if PIN_EXISTS(FAN)
+    PwmInput fan0(FAN_PIN);
+    #define SIM_FAN &fan0
+  #else
+    #define SIM_FAN nullptr
+  #endif
+  constexpr float e_steps[] = DEFAULT_AXIS_STEPS_PER_UNIT;
+  const heater_sim_t hotend_params = SIM_HOTEND_PARAMS;
+  // Sensors without a lookup table (MAX6675, MAX31865...) leave the ADC pin alone
+  #define _SIM_TEMPTABLE(N) TERN(TEMP_SENSOR_##N##_IS_THERMISTOR, TEMPTABLE_##N, nullptr), \
+                            TERN(TEMP_SENSOR_##N##_IS_THERMISTOR, TEMPTABLE_##N##_LEN, 0)
+  // Each hotend is fed by its own extruder, or by E0 when they share one (e.g., SINGLENOZZLE, MIXING_EXTRUDER)
+  #define _SIM_E(N) _MIN(N, E_STEPPERS - 1)
+  #define _SIM_HOTEND(N) { HEATER_##N##_PIN, TEMP_##N##_PIN, hotend_params, _SIM_TEMPTABLE(N), SIM_FAN, \
+                           &extruder[_SIM_E(N)], e_steps[E_AXIS_N(_SIM_E(N))] },
+  Heater hotend[] = { REPEAT(HOTENDS, _SIM_HOTEND) };
+  #if HAS_HEATED_BED
+    const heater_sim_t bed_params = SIM_BED_PARAMS;
+    #ifdef TEMPTABLE_BED
+      Heater bed(HEATER_BED_PIN, TEMP_BED_PIN, bed_params, TEMPTABLE_BED, TEMPTABLE_BED_LEN, SIM_FAN);
+    #else
+      Heater bed(HEATER_BED_PIN, TEMP_BED_PIN, bed_params, nullptr, 0, SIM_FAN);
+    #endif
+  #endif
+  #if HAS_HEATED_CHAMBER
+    const heater_sim_t chamber_params = SIM_CHAMBER_PARAMS;
+    #ifdef TEMPTABLE_CHAMBER
+      Heater chamber(HEATER_CHAMBER_PIN, TEMP_CHAMBER_PIN, chamber_params, TEMPTABLE_CHAMBER, TEMPTABLE_CHAMBER_LEN);
+    #else
+      Heater chamber(HEATER_CHAMBER_PIN, TEMP_CHAMBER_PIN, chamber_params);
+    #endif
+  #endif
 
   #ifdef GPIO_LOGGING
     IOLoggerCSV logger("all_gpio_log.csv");
@@ -80,13 +117,14 @@ void simulation_loop() {
 
   for (;;) {
 
-    hotend.update();
-    bed.update();
+    for (auto &h : hotend) h.update();
+    TERN_(HAS_HEATED_BED, bed.update());
+    TERN_(HAS_HEATED_CHAMBER, chamber.update());
 
     x_axis.update();
     y_axis.update();
     z_axis.update();
-    extruder0.update();
+    for (auto &e : extruder) e.update();
 
     #ifdef GPIO_LOGGING
       if (x_axis.position != x || y_axis.position != y || z_axis.position != z) {
@@ -116,7 +154,7 @@ int main() {
   #endif
 
   Clock::setFrequency(F_CPU);
-  Clock::setTimeMultiplier(1.0); // some testing at 10x
+  Clock::setTimeMultiplier(SIM_TIME_MULTIPLIER);
 
   HAL_timer_init();
 
@@ -95,7 +95,231 @@
   static_assert(IS_FLASH_SECTOR(FLASH_SECTOR), "FLASH_SECTOR is invalid");
   static_assert(IS_POWER_OF_2(FLASH_UNIT_SIZE), "FLASH_UNIT_SIZE should be a power of 2, please check your chip's spec sheet");
 
-#endif // FLASH_EEPROM_LEVELING
+#elif ENABLED(FLASH_EEPROM_JOURNAL)
+
+  #include "stm32_def.h"
+
+  #define DEBUG_OUT ENABLED(EEPROM_CHITCHAT)
+  #include "../../core/debug_out.h"
+
+  #ifndef MARLIN_EEPROM_SIZE
+    #define MARLIN_EEPROM_SIZE    0x1000 // 4KB
+  #endif
+
+  #ifndef FLASH_SECTOR
+    #define FLASH_SECTOR          (FLASH_SECTOR_TOTAL - 1)
+  #endif
+  #ifndef FLASH_UNIT_SIZE
+    #define FLASH_UNIT_SIZE       0x20000 // 128kB
+  #endif
+
+  /**
+   * The journal uses two sectors, FLASH_SECTOR - 1 and FLASH_SECTOR. Each one
+   * starts with a sequence number, which is written only after the sector has
+   * been filled with a complete snapshot. The valid sector with the higher
+   * number is the live one. Records of changed bytes follow the number:
+   *
+   *   uint16_t addr, len, crc, check - check is ~addr; crc covers addr, len, and the data
+   *   uint8_t data[len]              - padded with 0xFF to a whole word
+   *
+   * An erased header word ends the journal. Loading replays every record into
+   * RAM. A record torn by a power loss fails its CRC and ends the replay, and
+   * the next save writes a new snapshot into the other sector.
+   */
+  #define JOURNAL_SECTOR(B)       ((FLASH_SECTOR) - 1 + (B))
+  #define JOURNAL_ADDRESS(B)      (FLASH_END - ((FLASH_SECTOR_TOTAL - JOURNAL_SECTOR(B)) * (FLASH_UNIT_SIZE)) + 1)
+  #define JOURNAL_CHUNK           256   // Longest record, also used for snapshots
+
+  #define UNLOCK_FLASH()          if (!flash_unlocked) { \
+                                    HAL_FLASH_Unlock(); \
+                                    __HAL_FLASH_CLEAR_FLAG(FLASH_FLAG_EOP | FLASH_FLAG_OPERR | FLASH_FLAG_WRPERR | \
+                                                           FLASH_FLAG_PGAERR | FLASH_FLAG_PGPERR | FLASH_FLAG_PGSERR); \
+                                    flash_unlocked = true; \
+                                  }
+  #define LOCK_FLASH()            if (flash_unlocked) { HAL_FLASH_Lock(); flash_unlocked = false; }
+
+  #define EMPTY_UINT32            ((uint32_t)-1)
+
+  typedef struct { uint16_t addr, len, crc, check; } journal_record_t;
+
+  static uint8_t ram_eeprom[MARLIN_EEPROM_SIZE] __attribute__((aligned(4)));
+  static uint8_t journal_dirty[(MARLIN_EEPROM_SIZE + 7) / 8]; // Bytes changed since the last save
+  static bool journal_loaded, journal_torn,
+              journal_blocked;          // The firmware reaches into the journal sectors
+  static int8_t journal_sector = -1;    // Live sector (0 or 1), or -1 if nothing is saved yet
+  static uint32_t journal_seq,          // Sequence number of the live sector
+                  journal_next;         // Address for the next record
+
+  static_assert(0 == MARLIN_EEPROM_SIZE % 4, "MARLIN_EEPROM_SIZE must be a multiple of 4");
+  static_assert(MARLIN_EEPROM_SIZE <= 0x10000, "MARLIN_EEPROM_SIZE must be 64K or less for FLASH_EEPROM_JOURNAL");
+  static_assert(IS_FLASH_SECTOR((FLASH_SECTOR) - 1), "FLASH_EEPROM_JOURNAL needs the sector below FLASH_SECTOR");
+  static_assert(IS_POWER_OF_2(FLASH_UNIT_SIZE), "FLASH_UNIT_SIZE should be a power of 2, please check your chip's spec sheet");
+  static_assert(MARLIN_EEPROM_SIZE + (MARLIN_EEPROM_SIZE / JOURNAL_CHUNK + 1) * sizeof(journal_record_t) < FLASH_UNIT_SIZE, "FLASH_UNIT_SIZE is too small for a snapshot of MARLIN_EEPROM_SIZE");
+
+  // The end of the firmware image in flash, from the linker script
+  extern "C" uint32_t _sidata, _sdata, _edata;
+  static uint32_t firmware_end() { return uint32_t(&_sidata) + (uint32_t(&_edata) - uint32_t(&_sdata)); }
+
+  static uint32_t journal_record_size(const uint16_t len) { return (sizeof(journal_record_t) + len + 3) & ~3UL; }
+
+  static uint16_t journal_record_crc(const journal_record_t &rec, const uint8_t * const data) {
+    uint16_t crc = 0;
+    crc16(&crc, &rec, 2 * sizeof(uint16_t));
+    crc16(&crc, data, rec.len);
+    return crc;
+  }
+
+  // Rebuild the settings image from the live sector
+  static void journal_load() {
+    memset(ram_eeprom, 0xFF, sizeof(ram_eeprom));
+    memset(journal_dirty, 0, sizeof(journal_dirty));
+    journal_loaded = true;
+    journal_torn = false;
+
+    journal_sector = -1;
+
+    // Never read code as settings, nor erase it
+    journal_blocked = firmware_end() > JOURNAL_ADDRESS(0);
+    if (journal_blocked) {
+      SERIAL_ERROR_MSG("FLASH_EEPROM_JOURNAL: Firmware overlaps sector ", JOURNAL_SECTOR(0), ". Settings won't be saved.");
+      return;
+    }
+
+    for (uint8_t b = 0; b < 2; ++b) {
+      const uint32_t seq = *(__IO uint32_t*)JOURNAL_ADDRESS(b);
+      if (seq != EMPTY_UINT32 && (journal_sector < 0 || seq > journal_seq)) {
+        journal_sector = b;
+        journal_seq = seq;
+      }
+    }
+    if (journal_sector < 0) return;
+
+    const uint32_t end = JOURNAL_ADDRESS(journal_sector) + FLASH_UNIT_SIZE;
+    uint32_t address = JOURNAL_ADDRESS(journal_sector) + sizeof(uint32_t);
+    uint16_t records = 0;
+    while (address + sizeof(journal_record_t) <= end && *(__IO uint32_t*)address != EMPTY_UINT32) {
+      journal_record_t rec;
+      memcpy(&rec, (void*)address, sizeof(rec));
+      const uint8_t * const data = (uint8_t*)(address + sizeof(rec));
+      if (rec.check != uint16_t(~rec.addr) || !rec.len || rec.len > JOURNAL_CHUNK
+        || rec.addr + rec.len > MARLIN_EEPROM_SIZE || address + journal_record_size(rec.len) > end
+        || journal_record_crc(rec, data) != rec.crc
+      ) {
+        journal_torn = true;
+        DEBUG_ECHOLNPGM("EEPROM journal record ", records, " is damaged.");
+        break;
+      }
+      memcpy(ram_eeprom + rec.addr, data, rec.len);
+      address += journal_record_size(rec.len);
+      ++records;
+    }
+    journal_next = address;
+    DEBUG_ECHOLNPGM("EEPROM journal: sector ", JOURNAL_SECTOR(journal_sector), ", ", records, " records, ", address - JOURNAL_ADDRESS(journal_sector), " bytes.");
+  }
+
+  // Program whole words, padding the last one with 0xFF
+  static bool journal_program(uint32_t &address, const void * const data, const uint32_t size) {
+    for (uint32_t i = 0; i < size; i += sizeof(uint32_t)) {
+      uint32_t word = EMPTY_UINT32;
+      memcpy(&word, (const uint8_t*)data + i, _MIN(sizeof(uint32_t), size - i));
+      const HAL_StatusTypeDef status = HAL_FLASH_Program(FLASH_TYPEPROGRAM_WORD, address, word);
+      if (status != HAL_OK) {
+        DEBUG_ECHOLNPGM("HAL_FLASH_Program=", status);
+        DEBUG_ECHOLNPGM("GetError=", HAL_FLASH_GetError());
+        DEBUG_ECHOLNPGM("address=", address);
+        return false;
+      }
+      address += sizeof(uint32_t);
+    }
+    return true;
+  }
+
+  static bool journal_append(const uint16_t pos, const uint16_t len) {
+    journal_record_t rec = { pos, len, 0, uint16_t(~pos) };
+    rec.crc = journal_record_crc(rec, ram_eeprom + pos);
+    return journal_program(journal_next, &rec, sizeof(rec)) && journal_program(journal_next, ram_eeprom + pos, len);
+  }
+
+  // Write a snapshot into the other sector, then make it live with the next sequence number
+  static bool journal_compact() {
+    const uint8_t b = journal_sector < 0 ? 0 : !journal_sector;
+
+    FLASH_EraseInitTypeDef EraseInitStruct;
+    uint32_t SectorError = 0;
+    EraseInitStruct.TypeErase = FLASH_TYPEERASE_SECTORS;
+    EraseInitStruct.VoltageRange = FLASH_VOLTAGE_RANGE_3;
+    EraseInitStruct.Sector = JOURNAL_SECTOR(b);
+    EraseInitStruct.NbSectors = 1;
+
+    TERN_(HAS_PAUSE_SERVO_OUTPUT, PAUSE_SERVO_OUTPUT());
+    hal.isr_off();
+    const HAL_StatusTypeDef status = HAL_FLASHEx_Erase(&EraseInitStruct, &SectorError);
+    hal.isr_on();
+    TERN_(HAS_PAUSE_SERVO_OUTPUT, RESUME_SERVO_OUTPUT());
+    if (status != HAL_OK) {
+      DEBUG_ECHOLNPGM("HAL_FLASHEx_Erase=", status);
+      DEBUG_ECHOLNPGM("GetError=", HAL_FLASH_GetError());
+      DEBUG_ECHOLNPGM("SectorError=", SectorError);
+      return false;
+    }
+
+    // Records for every chunk that isn't blank
+    journal_next = JOURNAL_ADDRESS(b) + sizeof(uint32_t);
+    for (uint32_t pos = 0; pos < MARLIN_EEPROM_SIZE; pos += JOURNAL_CHUNK) {
+      const uint16_t len = _MIN(uint32_t(JOURNAL_CHUNK), MARLIN_EEPROM_SIZE - pos);
+      bool blank = true;
+      for (uint16_t i = 0; blank && i < len; ++i) blank = ram_eeprom[pos + i] == 0xFF;
+      if (!blank && !journal_append(pos, len)) return false;
+    }
+
+    // The sequence number goes last so a partial snapshot is never live
+    const uint32_t seq = journal_sector < 0 ? 1 : journal_seq + 1;
+    uint32_t address = JOURNAL_ADDRESS(b);
+    if (!journal_program(address, &seq, sizeof(seq))) return false;
+
+    journal_sector = b;
+    journal_seq = seq;
+    journal_torn = false;
+    DEBUG_ECHOLNPGM("EEPROM journal compacted into sector ", JOURNAL_SECTOR(b), ".");
+    return true;
+  }
+
+  // Append a record for each run of changed bytes, or compact when the sector is full
+  static bool journal_save() {
+    if (journal_blocked) return false;
+
+    bool flash_unlocked = false;
+    UNLOCK_FLASH();
+
+    bool success = true, compact = journal_sector < 0 || journal_torn;
+    const uint32_t end = compact ? 0 : JOURNAL_ADDRESS(journal_sector) + FLASH_UNIT_SIZE;
+    for (uint32_t pos = 0; !compact && pos < MARLIN_EEPROM_SIZE; ++pos) {
+      if (!TEST(journal_dirty[pos >> 3], pos & 7)) continue;
+
+      // Take in later changes, bridging gaps shorter than a record header
+      uint32_t last = pos;
+      for (uint32_t i = pos + 1; i < MARLIN_EEPROM_SIZE && i - last <= sizeof(journal_record_t) && i - pos < JOURNAL_CHUNK; ++i)
+        if (TEST(journal_dirty[i >> 3], i & 7)) last = i;
+
+      const uint16_t len = last - pos + 1;
+      if (journal_next + journal_record_size(len) > end)
+        compact = true;
+      else if (!journal_append(pos, len)) {
+        journal_torn = true;
+        compact = true;
+      }
+      pos = last;
+    }
+
+    if (compact) success = journal_compact();
+
+    LOCK_FLASH();
+
+    if (success) memset(journal_dirty, 0, sizeof(journal_dirty));
+    return success;
+  }
+
+#endif // FLASH_EEPROM_JOURNAL
 
 static bool eeprom_data_written = false;
 
@@ -138,6 +362,10 @@ bool PersistentStore::access_start() {
       eeprom_data_written = false;
     }
 
+  #elif ENABLED(FLASH_EEPROM_JOURNAL)
+
+    if (!journal_loaded) journal_load();
+
   #else
     eeprom_buffer_fill();
   #endif
@@ -221,6 +449,12 @@ bool PersistentStore::access_finish() {
 
       return success;
 
+    #elif ENABLED(FLASH_EEPROM_JOURNAL)
+
+      const bool success = journal_save();
+      if (success) eeprom_data_written = false;
+      return success;
+
     #else // !FLASH_EEPROM_LEVELING
 
       // The following was written for the STM32F4 but may work with other MCUs as well.
@@ -237,7 +471,7 @@ bool PersistentStore::access_finish() {
 
       eeprom_data_written = false;
 
-    #endif // !FLASH_EEPROM_LEVELING
+    #endif // !FLASH_EEPROM_LEVELING && !FLASH_EEPROM_JOURNAL
   }
 
   return true;
@@ -251,6 +485,12 @@ bool PersistentStore::write_data(int &pos, const uint8_t *value, size_t size, ui
         ram_eeprom[pos] = v;
         eeprom_data_written = true;
       }
+    #elif ENABLED(FLASH_EEPROM_JOURNAL)
+      if (v != ram_eeprom[pos]) {
+        ram_eeprom[pos] = v;
+        SBI(journal_dirty[pos >> 3], pos & 7);
+        eeprom_data_written = true;
+      }
     #else
       if (v != eeprom_buffered_read_byte(pos)) {
         eeprom_buffered_write_byte(pos, v);
@@ -266,7 +506,11 @@ bool PersistentStore::write_data(int &pos, const uint8_t *value, size_t size, ui
 
 bool PersistentStore::read_data(int &pos, uint8_t *value, size_t size, uint16_t *crc, const bool writing/*=true*/) {
   do {
-    const uint8_t c = TERN(FLASH_EEPROM_LEVELING, ram_eeprom[pos], eeprom_buffered_read_byte(pos));
+    #if EITHER(FLASH_EEPROM_LEVELING, FLASH_EEPROM_JOURNAL)
+      const uint8_t c = ram_eeprom[pos];
+    #else
+      const uint8_t c = eeprom_buffered_read_byte(pos);
+    #endif
     if (writing) *value = c;
     crc16(crc, &c, 1);
     pos++;
@@ -32,3 +32,8 @@
 #if defined(STM32F4xx) && ENABLED(FLASH_EEPROM_EMULATION) && PRINTCOUNTER_SAVE_INTERVAL > 0
   #define PRINTCOUNTER_SYNC 1
 #endif
+
+// The settings journal replaces the wear leveling enabled by some STM32F4 pins files
+#if ENABLED(FLASH_EEPROM_JOURNAL)
+  #undef FLASH_EEPROM_LEVELING
+#endif
@@ -41,6 +41,14 @@
   #error "FLASH_EEPROM_LEVELING is currently only supported on STM32F4 hardware."
 #endif
 
+#if ENABLED(FLASH_EEPROM_JOURNAL)
+  #if !defined(STM32F4xx)
+    #error "FLASH_EEPROM_JOURNAL is currently only supported on STM32F4 hardware."
+  #elif DISABLED(FLASH_EEPROM_EMULATION)
+    #error "FLASH_EEPROM_JOURNAL requires FLASH_EEPROM_EMULATION."
+  #endif
+#endif
+
 #if ENABLED(SERIAL_STATS_MAX_RX_QUEUED)
   #error "SERIAL_STATS_MAX_RX_QUEUED is not supported on STM32."
 #elif ENABLED(SERIAL_STATS_DROPPED_RX)
@@ -250,6 +250,10 @@
   #include "feature/easythreed_ui.h"
 #endif
 
+#if ENABLED(PATH_BLENDING)
+  #include "feature/path_blend.h"
+#endif
+
 #if ENABLED(MARLIN_TEST_BUILD)
   #include "tests/marlin_tests.h"
 #endif
@@ -833,6 +837,9 @@ void idle(bool no_stepper_sleep/*=false*/) {
   // Handle SD Card insert / remove
   TERN_(SDSUPPORT, card.manage_media());
 
+  // Index and sort the media directory a little at a time
+  TERN_(SDSORT_BACKGROUND, card.presort_idle());
+
   // Handle USB Flash Drive insert / remove
   TERN_(USB_FLASH_DRIVE_SUPPORT, card.diskIODriver()->idle());
 
@@ -877,6 +884,15 @@ void idle(bool no_stepper_sleep/*=false*/) {
   // Update the Průša MMU2
   TERN_(HAS_PRUSA_MMU2, mmu2.mmu_loop());
 
+  // Preheat the next tool ahead of its tool-change
+  TERN_(TOOLCHANGE_PREHEAT, toolchange_preheat_lookahead());
+
+  // Buffer a held G64 move once the planner runs low
+  TERN_(PATH_BLENDING, path_blend.idle());
+
+  // Buffer more segments of a streamed move
+  TERN_(STREAMING_SEGMENTS, segment_stream.advance());
+
   // Handle Joystick jogging
   TERN_(POLL_JOG, joystick.inject_jog_moves());
 
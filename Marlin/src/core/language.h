@@ -123,6 +123,9 @@
 #define STR_NO_MEDIA                        "No media"
 #define STR_BEGIN_FILE_LIST                 "Begin file list"
 #define STR_END_FILE_LIST                   "End file list"
+#define STR_FILE_LIST_MORE                  "More files at S"
+#define STR_FILE_LIST_TOKEN                 "File list token K"
+#define STR_FILE_LIST_UNCHANGED             "File list unchanged"
 #define STR_INVALID_EXTRUDER                "Invalid extruder"
 #define STR_INVALID_E_STEPPER               "Invalid E stepper"
 #define STR_E_STEPPER_NOT_SPECIFIED         "E stepper not specified"
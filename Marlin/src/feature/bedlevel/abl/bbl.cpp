@@ -161,7 +161,11 @@ void LevelingBilinear::print_leveling_grid(const bed_mesh_t* _z_values /*= NULL*
   #if ENABLED(ABL_BILINEAR_SUBDIVISION)
     if (!_z_values) {
       SERIAL_ECHOLNPGM("Subdivided with CATMULL ROM Leveling Grid:");
-      print_2d_array(ABL_GRID_POINTS_VIRT_X, ABL_GRID_POINTS_VIRT_Y, 5, z_values_virt[0]);
+      #if ENABLED(OPTIMIZED_MESH_STORAGE)
+        print_2d_array(ABL_GRID_POINTS_VIRT_X, ABL_GRID_POINTS_VIRT_Y, 5, virt_z, &z_values_virt);
+      #else
+        print_2d_array(ABL_GRID_POINTS_VIRT_X, ABL_GRID_POINTS_VIRT_Y, 5, z_values_virt[0]);
+      #endif
     }
   #endif
 }
@@ -170,7 +174,11 @@ void LevelingBilinear::print_leveling_grid(const bed_mesh_t* _z_values /*= NULL*
 
   #define ABL_TEMP_POINTS_X (GRID_MAX_POINTS_X + 2)
   #define ABL_TEMP_POINTS_Y (GRID_MAX_POINTS_Y + 2)
-  float LevelingBilinear::z_values_virt[ABL_GRID_POINTS_VIRT_X][ABL_GRID_POINTS_VIRT_Y];
+  #if ENABLED(OPTIMIZED_MESH_STORAGE)
+    packed_mesh_t<ABL_GRID_POINTS_VIRT_X, ABL_GRID_POINTS_VIRT_Y> LevelingBilinear::z_values_virt;
+  #else
+    float LevelingBilinear::z_values_virt[ABL_GRID_POINTS_VIRT_X][ABL_GRID_POINTS_VIRT_Y];
+  #endif
   xy_pos_t LevelingBilinear::grid_spacing_virt;
   xy_float_t LevelingBilinear::grid_factor_virt;
 
@@ -243,37 +251,37 @@ void LevelingBilinear::print_leveling_grid(const bed_mesh_t* _z_values /*= NULL*
   void LevelingBilinear::bed_level_virt_interpolate() {
     grid_spacing_virt = grid_spacing / (BILINEAR_SUBDIVISIONS);
     grid_factor_virt = grid_spacing_virt.reciprocal();
+    // Offsets are stored relative to the plane of the probed grid
+    TERN_(OPTIMIZED_MESH_STORAGE, z_values_virt.fit_plane(z_values, BILINEAR_SUBDIVISIONS));
     LOOP_L_N(y, GRID_MAX_POINTS_Y)
       LOOP_L_N(x, GRID_MAX_POINTS_X)
         LOOP_L_N(ty, BILINEAR_SUBDIVISIONS)
           LOOP_L_N(tx, BILINEAR_SUBDIVISIONS) {
             if ((ty && y == (GRID_MAX_POINTS_Y) - 1) || (tx && x == (GRID_MAX_POINTS_X) - 1))
               continue;
-            z_values_virt[x * (BILINEAR_SUBDIVISIONS) + tx][y * (BILINEAR_SUBDIVISIONS) + ty] =
-              bed_level_virt_2cmr(
-                x + 1,
-                y + 1,
-                (float)tx / (BILINEAR_SUBDIVISIONS),
-                (float)ty / (BILINEAR_SUBDIVISIONS)
-              );
+            const float z = bed_level_virt_2cmr(
+              x + 1,
+              y + 1,
+              (float)tx / (BILINEAR_SUBDIVISIONS),
+              (float)ty / (BILINEAR_SUBDIVISIONS)
+            );
+            const uint8_t vx = x * (BILINEAR_SUBDIVISIONS) + tx, vy = y * (BILINEAR_SUBDIVISIONS) + ty;
+            #if ENABLED(OPTIMIZED_MESH_STORAGE)
+              z_values_virt.set(vx, vy, z);
+            #else
+              z_values_virt[vx][vy] = z;
+            #endif
           }
   }
 
 #endif // ABL_BILINEAR_SUBDIVISION
 
-// Refresh after other values have been updated
-void LevelingBilinear::refresh_bed_level() {
-  TERN_(ABL_BILINEAR_SUBDIVISION, bed_level_virt_interpolate());
-  cached_rel.x = cached_rel.y = -999.999;
-  cached_g.x = cached_g.y = -99;
-}
-
 #if ENABLED(ABL_BILINEAR_SUBDIVISION)
   #define ABL_BG_SPACING(A) grid_spacing_virt.A
   #define ABL_BG_FACTOR(A)  grid_factor_virt.A
   #define ABL_BG_POINTS_X   ABL_GRID_POINTS_VIRT_X
   #define ABL_BG_POINTS_Y   ABL_GRID_POINTS_VIRT_Y
-  #define ABL_BG_GRID(X,Y)  z_values_virt[X][Y]
+  #define ABL_BG_GRID(X,Y)  TERN(OPTIMIZED_MESH_STORAGE, z_values_virt.get(X,Y), z_values_virt[X][Y])
 #else
   #define ABL_BG_SPACING(A) grid_spacing.A
   #define ABL_BG_FACTOR(A)  grid_factor.A
@@ -282,88 +290,145 @@ void LevelingBilinear::refresh_bed_level() {
   #define ABL_BG_GRID(X,Y)  z_values[X][Y]
 #endif
 
-// Get the Z adjustment for non-linear bed leveling
-float LevelingBilinear::get_z_correction(const xy_pos_t &raw) {
+#if ENABLED(ABL_BILINEAR_CELL_CACHE)
 
-  static float z1, d2, z3, d4, L, D;
+  LevelingBilinear::cell_coeff_t LevelingBilinear::cell_coeff[ABL_CACHE_CELLS_X][ABL_CACHE_CELLS_Y];
 
-  static xy_pos_t ratio;
+  /**
+   * Precompute the bilinear patch of every cell so a correction
+   * is one cell lookup and three multiply-adds.
+   */
+  void LevelingBilinear::refresh_cell_cache() {
+    LOOP_L_N(x, ABL_CACHE_CELLS_X)
+      LOOP_L_N(y, ABL_CACHE_CELLS_Y) {
+        const float z00 = ABL_BG_GRID(x, y),     z10 = ABL_BG_GRID(x + 1, y),
+                    z01 = ABL_BG_GRID(x, y + 1), z11 = ABL_BG_GRID(x + 1, y + 1);
+        cell_coeff_t &c = cell_coeff[x][y];
+        c.a = z00;
+        c.b = z10 - z00;
+        c.c = z01 - z00;
+        c.d = z11 - z10 - z01 + z00;
+      }
+  }
 
-  // Whole units for the grid line indices. Constrained within bounds.
-  static xy_int8_t thisg, nextg;
+#endif
 
-  // XY relative to the probed area
-  xy_pos_t rel = raw - grid_start.asFloat();
+// Refresh after other values have been updated
+void LevelingBilinear::refresh_bed_level() {
+  TERN_(ABL_BILINEAR_SUBDIVISION, bed_level_virt_interpolate());
+  TERN_(ABL_BILINEAR_CELL_CACHE, refresh_cell_cache());
+  cached_rel.x = cached_rel.y = -999.999;
+  cached_g.x = cached_g.y = -99;
+}
 
-  #if ENABLED(EXTRAPOLATE_BEYOND_GRID)
-    #define FAR_EDGE_OR_BOX 2   // Keep using the last grid box
-  #else
-    #define FAR_EDGE_OR_BOX 1   // Just use the grid far edge
-  #endif
+// Get the Z adjustment for non-linear bed leveling
+float LevelingBilinear::get_z_correction(const xy_pos_t &raw) {
+
+  #if ENABLED(ABL_BILINEAR_CELL_CACHE)
+
+    // Position in grid units relative to the probed area
+    xy_pos_t ratio = raw - grid_start.asFloat();
+    ratio.x *= ABL_BG_FACTOR(x);
+    ratio.y *= ABL_BG_FACTOR(y);
 
-  if (cached_rel.x != rel.x) {
-    cached_rel.x = rel.x;
-    ratio.x = rel.x * ABL_BG_FACTOR(x);
-    const float gx = constrain(FLOOR(ratio.x), 0, ABL_BG_POINTS_X - (FAR_EDGE_OR_BOX));
-    ratio.x -= gx;      // Subtract whole to get the ratio within the grid box
+    // Cell containing the point, constrained to the grid
+    const int8_t gx = constrain(FLOOR(ratio.x), 0, ABL_CACHE_CELLS_X - 1),
+                 gy = constrain(FLOOR(ratio.y), 0, ABL_CACHE_CELLS_Y - 1);
+    ratio.x -= gx;
+    ratio.y -= gy;
 
     #if DISABLED(EXTRAPOLATE_BEYOND_GRID)
       // Beyond the grid maintain height at grid edges
-      NOLESS(ratio.x, 0); // Never <0 (>1 is ok when nextg.x==thisg.x)
+      LIMIT(ratio.x, 0, 1);
+      LIMIT(ratio.y, 0, 1);
     #endif
 
-    thisg.x = gx;
-    nextg.x = _MIN(thisg.x + 1, ABL_BG_POINTS_X - 1);
-  }
+    const cell_coeff_t &c = cell_coeff[gx][gy];
+    return c.a + ratio.x * (c.b + ratio.y * c.d) + ratio.y * c.c;
+
+  #else
 
-  if (cached_rel.y != rel.y || cached_g.x != thisg.x) {
+    static float z1, d2, z3, d4, L, D;
 
-    if (cached_rel.y != rel.y) {
-      cached_rel.y = rel.y;
-      ratio.y = rel.y * ABL_BG_FACTOR(y);
-      const float gy = constrain(FLOOR(ratio.y), 0, ABL_BG_POINTS_Y - (FAR_EDGE_OR_BOX));
-      ratio.y -= gy;
+    static xy_pos_t ratio;
+
+    // Whole units for the grid line indices. Constrained within bounds.
+    static xy_int8_t thisg, nextg;
+
+    // XY relative to the probed area
+    xy_pos_t rel = raw - grid_start.asFloat();
+
+    #if ENABLED(EXTRAPOLATE_BEYOND_GRID)
+      #define FAR_EDGE_OR_BOX 2   // Keep using the last grid box
+    #else
+      #define FAR_EDGE_OR_BOX 1   // Just use the grid far edge
+    #endif
+
+    if (cached_rel.x != rel.x) {
+      cached_rel.x = rel.x;
+      ratio.x = rel.x * ABL_BG_FACTOR(x);
+      const float gx = constrain(FLOOR(ratio.x), 0, ABL_BG_POINTS_X - (FAR_EDGE_OR_BOX));
+      ratio.x -= gx;      // Subtract whole to get the ratio within the grid box
 
       #if DISABLED(EXTRAPOLATE_BEYOND_GRID)
         // Beyond the grid maintain height at grid edges
-        NOLESS(ratio.y, 0); // Never < 0.0. (> 1.0 is ok when nextg.y==thisg.y.)
+        NOLESS(ratio.x, 0); // Never <0 (>1 is ok when nextg.x==thisg.x)
       #endif
 
-      thisg.y = gy;
-      nextg.y = _MIN(thisg.y + 1, ABL_BG_POINTS_Y - 1);
+      thisg.x = gx;
+      nextg.x = _MIN(thisg.x + 1, ABL_BG_POINTS_X - 1);
     }
 
-    if (cached_g != thisg) {
-      cached_g = thisg;
-      // Z at the box corners
-      z1 = ABL_BG_GRID(thisg.x, thisg.y);       // left-front
-      d2 = ABL_BG_GRID(thisg.x, nextg.y) - z1;  // left-back (delta)
-      z3 = ABL_BG_GRID(nextg.x, thisg.y);       // right-front
-      d4 = ABL_BG_GRID(nextg.x, nextg.y) - z3;  // right-back (delta)
-    }
+    if (cached_rel.y != rel.y || cached_g.x != thisg.x) {
 
-    // Bilinear interpolate. Needed since rel.y or thisg.x has changed.
-                L = z1 + d2 * ratio.y;   // Linear interp. LF -> LB
-    const float R = z3 + d4 * ratio.y;   // Linear interp. RF -> RB
+      if (cached_rel.y != rel.y) {
+        cached_rel.y = rel.y;
+        ratio.y = rel.y * ABL_BG_FACTOR(y);
+        const float gy = constrain(FLOOR(ratio.y), 0, ABL_BG_POINTS_Y - (FAR_EDGE_OR_BOX));
+        ratio.y -= gy;
 
-    D = R - L;
-  }
+        #if DISABLED(EXTRAPOLATE_BEYOND_GRID)
+          // Beyond the grid maintain height at grid edges
+          NOLESS(ratio.y, 0); // Never < 0.0. (> 1.0 is ok when nextg.y==thisg.y.)
+        #endif
+
+        thisg.y = gy;
+        nextg.y = _MIN(thisg.y + 1, ABL_BG_POINTS_Y - 1);
+      }
 
-  const float offset = L + ratio.x * D;   // the offset almost always changes
+      if (cached_g != thisg) {
+        cached_g = thisg;
+        // Z at the box corners
+        z1 = ABL_BG_GRID(thisg.x, thisg.y);       // left-front
+        d2 = ABL_BG_GRID(thisg.x, nextg.y) - z1;  // left-back (delta)
+        z3 = ABL_BG_GRID(nextg.x, thisg.y);       // right-front
+        d4 = ABL_BG_GRID(nextg.x, nextg.y) - z3;  // right-back (delta)
+      }
 
-  /*
-  static float last_offset = 0;
-  if (ABS(last_offset - offset) > 0.2) {
-    SERIAL_ECHOLNPGM("Sudden Shift at x=", rel.x, " / ", grid_spacing.x, " -> thisg.x=", thisg.x);
-    SERIAL_ECHOLNPGM(" y=", rel.y, " / ", grid_spacing.y, " -> thisg.y=", thisg.y);
-    SERIAL_ECHOLNPGM(" ratio.x=", ratio.x, " ratio.y=", ratio.y);
-    SERIAL_ECHOLNPGM(" z1=", z1, " z2=", z2, " z3=", z3, " z4=", z4);
-    SERIAL_ECHOLNPGM(" L=", L, " R=", R, " offset=", offset);
-  }
-  last_offset = offset;
-  //*/
+      // Bilinear interpolate. Needed since rel.y or thisg.x has changed.
+                  L = z1 + d2 * ratio.y;   // Linear interp. LF -> LB
+      const float R = z3 + d4 * ratio.y;   // Linear interp. RF -> RB
+
+      D = R - L;
+    }
+
+    const float offset = L + ratio.x * D;   // the offset almost always changes
+
+    /*
+    static float last_offset = 0;
+    if (ABS(last_offset - offset) > 0.2) {
+      SERIAL_ECHOLNPGM("Sudden Shift at x=", rel.x, " / ", grid_spacing.x, " -> thisg.x=", thisg.x);
+      SERIAL_ECHOLNPGM(" y=", rel.y, " / ", grid_spacing.y, " -> thisg.y=", thisg.y);
+      SERIAL_ECHOLNPGM(" ratio.x=", ratio.x, " ratio.y=", ratio.y);
+      SERIAL_ECHOLNPGM(" z1=", z1, " z2=", z2, " z3=", z3, " z4=", z4);
+      SERIAL_ECHOLNPGM(" L=", L, " R=", R, " offset=", offset);
+    }
+    last_offset = offset;
+    //*/
+
+    return offset;
 
-  return offset;
+  #endif // !ABL_BILINEAR_CELL_CACHE
 }
 
 #if IS_CARTESIAN && DISABLED(SEGMENT_LEVELED_MOVES)
@@ -23,6 +23,10 @@
 
 #include "../../../inc/MarlinConfigPre.h"
 
+#if BOTH(ABL_BILINEAR_SUBDIVISION, OPTIMIZED_MESH_STORAGE)
+  #include "../packed_mesh.h"
+#endif
+
 class LevelingBilinear {
 public:
   static bed_mesh_t z_values;
@@ -39,7 +43,14 @@ private:
     #define ABL_GRID_POINTS_VIRT_X (GRID_MAX_CELLS_X * (BILINEAR_SUBDIVISIONS) + 1)
     #define ABL_GRID_POINTS_VIRT_Y (GRID_MAX_CELLS_Y * (BILINEAR_SUBDIVISIONS) + 1)
 
-    static float z_values_virt[ABL_GRID_POINTS_VIRT_X][ABL_GRID_POINTS_VIRT_Y];
+    #if ENABLED(OPTIMIZED_MESH_STORAGE)
+      static packed_mesh_t<ABL_GRID_POINTS_VIRT_X, ABL_GRID_POINTS_VIRT_Y> z_values_virt;
+      static float virt_z(const void *mesh, const uint8_t x, const uint8_t y) {
+        return static_cast<const decltype(z_values_virt)*>(mesh)->get(x, y);
+      }
+    #else
+      static float z_values_virt[ABL_GRID_POINTS_VIRT_X][ABL_GRID_POINTS_VIRT_Y];
+    #endif
     static xy_pos_t grid_spacing_virt;
     static xy_float_t grid_factor_virt;
 
@@ -49,6 +60,22 @@ private:
     static void bed_level_virt_interpolate();
   #endif
 
+  #if ENABLED(ABL_BILINEAR_CELL_CACHE)
+    #if ENABLED(ABL_BILINEAR_SUBDIVISION)
+      #define ABL_CACHE_CELLS_X (ABL_GRID_POINTS_VIRT_X - 1)
+      #define ABL_CACHE_CELLS_Y (ABL_GRID_POINTS_VIRT_Y - 1)
+    #else
+      #define ABL_CACHE_CELLS_X GRID_MAX_CELLS_X
+      #define ABL_CACHE_CELLS_Y GRID_MAX_CELLS_Y
+    #endif
+
+    // Bilinear patch of one cell: z = a + b * rx + c * ry + d * rx * ry
+    typedef struct { float a, b, c, d; } cell_coeff_t;
+    static cell_coeff_t cell_coeff[ABL_CACHE_CELLS_X][ABL_CACHE_CELLS_Y];
+
+    static void refresh_cell_cache();
+  #endif
+
 public:
   static void reset();
   static void set_grid(const xy_pos_t& _grid_spacing, const xy_pos_t& _grid_start);
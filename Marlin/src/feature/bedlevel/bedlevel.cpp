@@ -46,7 +46,12 @@
   #include "../../lcd/extui/ui_api.h"
 #endif
 
+#if ENABLED(EEPROM_LAZY_LOAD)
+  #include "../../module/settings.h"
+#endif
+
 bool leveling_is_valid() {
+  TERN_(EEPROM_LAZY_LOAD, settings.load_deferred());
   return TERN1(HAS_MESH, bedlevel.mesh_is_valid());
 }
 
@@ -59,6 +64,9 @@ bool leveling_is_valid() {
 void set_bed_leveling_enabled(const bool enable/*=true*/) {
   DEBUG_SECTION(log_sble, "set_bed_leveling_enabled", DEBUGGING(LEVELING));
 
+  // Read the stored mesh before it's applied
+  TERN_(EEPROM_LAZY_LOAD, settings.load_deferred());
+
   const bool can_change = TERN1(AUTO_BED_LEVELING_BILINEAR, !enable || leveling_is_valid());
 
   if (can_change && enable != planner.leveling_active) {
@@ -135,7 +143,7 @@ void reset_bed_level() {
   /**
    * Print calibration results for plotting or manual frame adjustment.
    */
-  void print_2d_array(const uint8_t sx, const uint8_t sy, const uint8_t precision, const float *values) {
+  void print_2d_array(const uint8_t sx, const uint8_t sy, const uint8_t precision, element_2d_fn get_element, const void *data) {
     #ifndef SCAD_MESH_OUTPUT
       LOOP_L_N(x, sx) {
         serial_spaces(precision + (x < 10 ? 3 : 2));
@@ -155,7 +163,7 @@ void reset_bed_level() {
       #endif
       LOOP_L_N(x, sx) {
         SERIAL_CHAR(' ');
-        const float offset = values[x * sy + y];
+        const float offset = get_element(data, x, y);
         if (!isnan(offset)) {
           if (offset >= 0) SERIAL_CHAR('+');
           SERIAL_ECHO_F(offset, int(precision));
@@ -186,6 +194,14 @@ void reset_bed_level() {
     SERIAL_EOL();
   }
 
+  void print_2d_array(const uint8_t sx, const uint8_t sy, const uint8_t precision, const float *values) {
+    struct flat_grid_t { const float *values; uint8_t sy; } grid = { values, sy };
+    print_2d_array(sx, sy, precision, [](const void *data, const uint8_t x, const uint8_t y) {
+      const flat_grid_t &g = *static_cast<const flat_grid_t*>(data);
+      return g.values[x * g.sy + y];
+    }, &grid);
+  }
+
 #endif // AUTO_BED_LEVELING_BILINEAR || MESH_BED_LEVELING
 
 #if EITHER(MESH_BED_LEVELING, PROBE_MANUALLY)
@@ -73,12 +73,13 @@ class TemporaryBedLevelingState {
 
     #include <stdint.h>
 
-    typedef float (*element_2d_fn)(const uint8_t, const uint8_t);
+    typedef float (*element_2d_fn)(const void *data, const uint8_t x, const uint8_t y);
 
     /**
      * Print calibration results for plotting or manual frame adjustment.
      */
     void print_2d_array(const uint8_t sx, const uint8_t sy, const uint8_t precision, const float *values);
+    void print_2d_array(const uint8_t sx, const uint8_t sy, const uint8_t precision, element_2d_fn get_element, const void *data);
 
   #endif
 
@@ -0,0 +1,83 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * packed_mesh.h - Meshes stored as 16-bit micrometer offsets from their mean plane
+ */
+
+#include "../../inc/MarlinConfigPre.h"
+#include "../../libs/least_squares_fit.h"
+
+template<uint8_t NX, uint8_t NY>
+struct packed_mesh_t {
+  static constexpr int16_t Z_NAN = INT16_MIN;
+
+  float z0, slope_x, slope_y;   // Mean plane (mm) in grid index space
+  int16_t um[NX][NY];           // Offset from the plane (µm)
+
+  float plane(const uint8_t x, const uint8_t y) const { return z0 + slope_x * x + slope_y * y; }
+
+  float get(const uint8_t x, const uint8_t y) const {
+    const int16_t v = um[x][y];
+    return v == Z_NAN ? NAN : plane(x, y) + v * 0.001f;
+  }
+
+  // Offsets beyond ±32mm from the plane are clamped
+  void set(const uint8_t x, const uint8_t y, const_float_t z) {
+    if (isnan(z)) { um[x][y] = Z_NAN; return; }
+    const int32_t v = LROUND((z - plane(x, y)) * 1000.0f);
+    um[x][y] = int16_t(constrain(v, int32_t(Z_NAN) + 1, int32_t(INT16_MAX)));
+  }
+
+  /**
+   * Fit the plane to the valid points of a float mesh. With 'sub' > 1 the mesh
+   * is that many times finer than the source, as for a subdivided grid.
+   */
+  template<uint8_t MX, uint8_t MY>
+  void fit_plane(const float (&z)[MX][MY], const uint8_t sub=1) {
+    linear_fit_data lsf;
+    incremental_LSF_reset(&lsf);
+    LOOP_L_N(x, MX) LOOP_L_N(y, MY)
+      if (!isnan(z[x][y])) incremental_LSF(&lsf, x, y, z[x][y]);
+
+    // Fall back to a level plane at the mean for degenerate meshes
+    if (finish_incremental_LSF(&lsf)) {
+      z0 = lsf.N ? lsf.zbar / lsf.N : 0;
+      slope_x = slope_y = 0;
+    }
+    else {
+      z0 = -lsf.D;
+      slope_x = -lsf.A / sub;
+      slope_y = -lsf.B / sub;
+    }
+  }
+
+  void pack(const float (&z)[NX][NY]) {
+    fit_plane(z);
+    LOOP_L_N(x, NX) LOOP_L_N(y, NY) set(x, y, z[x][y]);
+  }
+
+  void unpack(float (&z)[NX][NY]) const {
+    LOOP_L_N(x, NX) LOOP_L_N(y, NY) z[x][y] = get(x, y);
+  }
+};
@@ -160,6 +160,13 @@ public:
           if (Packet::Open::validate(buffer, length)) {
             auto packet = Packet::Open::decode(buffer);
             compression = packet.compression_enabled();
+            #if ENABLED(SDCARD_COMPRESSED_PRINT)
+              // A compressed stream sent to a *.HS file is stored as-is, ready to print
+              if (compression) {
+                const char * const dot = strrchr(packet.filename(), '.');
+                if (dot && toupper(dot[1]) == 'H' && toupper(dot[2]) == 'S' && !dot[3]) compression = false;
+              }
+            #endif
             dummy_transfer = packet.dummy_transfer();
             if (file_open(packet.filename())) {
               SERIAL_ECHOLNPGM("PFT:success");
@@ -0,0 +1,180 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * path_blend.cpp - G64 corner blending of consecutive G0/G1 moves
+ *
+ * Each G0/G1 is held back until the next one arrives. When both are flat XY
+ * moves the shared corner is cut by an arc tangent to both lines, sized so it
+ * passes within 'tolerance' of the corner and never eats more than half of
+ * either move. The arc goes through plan_arc, so its blocks carry the usual
+ * curvature hints and the planner takes it at a speed the radius allows.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(PATH_BLENDING)
+
+#include "path_blend.h"
+
+PathBlend path_blend;
+
+#include "../module/motion.h"
+#include "../module/planner.h"
+
+#if ENABLED(CNC_WORKSPACE_PLANES)
+  #include "../gcode/gcode.h"
+#endif
+
+void plan_arc(const xyze_pos_t&, const ab_float_t&, const bool, const uint8_t);
+
+float PathBlend::tolerance; // = 0
+bool PathBlend::held; // = false
+xyze_pos_t PathBlend::held_start, PathBlend::held_end;
+xy_float_t PathBlend::held_dir;
+float PathBlend::held_length;
+feedRate_t PathBlend::held_fr_mm_s;
+
+#if ENABLED(LASER_FEATURE)
+  static laser_state_t held_laser;  // Inline laser state of the held move
+#endif
+
+/**
+ * Buffer a line as a G1 would, so leveling and segmentation still apply,
+ * without disturbing the current position, destination, or feedrate.
+ */
+void PathBlend::line_to(const xyze_pos_t &start, const xyze_pos_t &end, const_feedRate_t fr_mm_s) {
+  const xyze_pos_t old_current = current_position, old_destination = destination;
+  const feedRate_t old_feedrate = feedrate_mm_s;
+  current_position = start;
+  destination = end;
+  feedrate_mm_s = fr_mm_s;
+  prepare_line_to_destination();
+  current_position = old_current;
+  destination = old_destination;
+  feedrate_mm_s = old_feedrate;
+}
+
+void PathBlend::flush() {
+  if (!held) return;
+  held = false;
+  #if ENABLED(LASER_FEATURE)
+    const laser_state_t laser = planner.laser_inline;
+    planner.laser_inline = held_laser;
+  #endif
+  line_to(held_start, held_end, held_fr_mm_s);
+  #if ENABLED(LASER_FEATURE)
+    TERN_(STREAMING_SEGMENTS, segment_stream.finish()); // Stream the segments with the held power
+    planner.laser_inline = laser;
+  #endif
+}
+
+void PathBlend::idle() {
+  // With nothing left to run after the current block, waiting for a corner only stalls
+  if (held && planner.movesplanned() < 2) flush();
+}
+
+void PathBlend::line_to_destination() {
+  apply_motion_limits(destination);
+
+  xy_float_t dir;
+  dir.set(destination.x - current_position.x, destination.y - current_position.y);
+  const float length = dir.magnitude();
+
+  // Only flat XY moves are blended
+  bool blend = tolerance && length > 0.001f;
+  LOOP_NUM_AXES(i) if (i > Y_AXIS && destination[i] != current_position[i]) blend = false;
+  if (!blend) {
+    flush();
+    prepare_line_to_destination();
+    return;
+  }
+  dir *= RECIPROCAL(length);
+
+  xyze_pos_t start = current_position; // Start of the part of this move to hold back
+
+  if (held && held_end == current_position
+    #if ENABLED(LASER_FEATURE)
+      && held_laser.power == planner.laser_inline.power
+      && held_laser.status.isEnabled == planner.laser_inline.status.isEnabled
+    #endif
+  ) {
+    // Half the turn angle decides the arc that passes 'tolerance' from the corner
+    const float cos_turn = held_dir.x * dir.x + held_dir.y * dir.y;
+    float trim = 0, radius = 0;
+    if (WITHIN(cos_turn, -0.9998f, 0.99998f)) { // Not straight on, nor a reversal
+      const float half_turn = ACOS(cos_turn) * 0.5f,
+                  cos_half = cos(half_turn),
+                  tan_half = tan(half_turn),
+                  max_trim = _MIN(held_length, length) * 0.5f;
+      radius = tolerance * cos_half / (1.0f - cos_half);
+      trim = radius * tan_half;
+      if (trim > max_trim) { trim = max_trim; radius = trim / tan_half; }
+    }
+
+    if (trim > 0.005f) {
+      // Tangent points on the held move and on this one, with E split in proportion
+      xyze_pos_t arc_start = held_end, arc_end = current_position;
+      const float held_mm = HYPOT(held_end.x - held_start.x, held_end.y - held_start.y);
+      arc_start.x -= held_dir.x * trim;
+      arc_start.y -= held_dir.y * trim;
+      arc_start.e -= (held_end.e - held_start.e) * trim / held_mm;
+      arc_end.x += dir.x * trim;
+      arc_end.y += dir.y * trim;
+      arc_end.e += (destination.e - current_position.e) * trim / length;
+
+      held_end = arc_start;
+      flush();
+
+      // The center lies 'radius' from the arc start, to the inside of the turn
+      const bool clockwise = held_dir.x * dir.y - held_dir.y * dir.x < 0;
+      ab_float_t offset;
+      offset.set(clockwise ? held_dir.y : -held_dir.y, clockwise ? -held_dir.x : held_dir.x);
+      offset *= radius;
+
+      current_position = arc_start;
+      #if ENABLED(CNC_WORKSPACE_PLANES)
+        const GcodeSuite::WorkspacePlane old_plane = gcode.workspace_plane;
+        gcode.workspace_plane = GcodeSuite::PLANE_XY;
+      #endif
+      plan_arc(arc_end, offset, clockwise, 0);
+      TERN_(CNC_WORKSPACE_PLANES, gcode.workspace_plane = old_plane);
+
+      start = arc_end;
+    }
+  }
+
+  flush();
+
+  // Hold the rest of this move until the next one shows its corner
+  held_start = start;
+  held_end = destination;
+  held_dir = dir;
+  held_length = length;
+  held_fr_mm_s = feedrate_mm_s;
+  TERN_(LASER_FEATURE, held_laser = planner.laser_inline);
+  held = true;
+
+  current_position = destination;
+}
+
+#endif // PATH_BLENDING
@@ -0,0 +1,57 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * path_blend.h - G64 corner blending of consecutive G0/G1 moves
+ */
+
+#include "../inc/MarlinConfigPre.h"
+
+class PathBlend {
+public:
+  static float tolerance;                   // (mm) G64 P - Largest distance from a corner to its arc. 0 for exact path.
+
+  static bool pending() { return held; }
+
+  // Buffer the G0/G1 in 'destination', blending its corner with the held move
+  static void line_to_destination();
+
+  // Buffer the rest of the held move so other motion can follow it
+  static void flush();
+
+  // Drop the held move (quick stop)
+  static void discard() { held = false; }
+
+  // Flush the held move once the planner is about to run dry
+  static void idle();
+
+private:
+  static bool held;
+  static xyze_pos_t held_start, held_end;   // The part of the last move not yet buffered
+  static xy_float_t held_dir;               // XY unit vector of the last move
+  static float held_length;                 // (mm) XY length of the whole last move
+  static feedRate_t held_fr_mm_s;
+  static void line_to(const xyze_pos_t &start, const xyze_pos_t &end, const_feedRate_t fr_mm_s);
+};
+
+extern PathBlend path_blend;
@@ -44,6 +44,14 @@ uint32_t PrintJobRecovery::cmd_sdpos, // = 0
   bool PrintJobRecovery::dwin_flag; // = false
 #endif
 
+#if ENABLED(POWER_LOSS_JOURNAL)
+  uint32_t PrintJobRecovery::journal_block, // = 0
+           PrintJobRecovery::journal_epoch,
+           PrintJobRecovery::journal_seq;
+  uint16_t PrintJobRecovery::journal_crc;
+  bool PrintJobRecovery::journal_off;       // = false
+#endif
+
 #include "../sd/cardreader.h"
 #include "../lcd/marlinui.h"
 #include "../gcode/queue.h"
@@ -62,6 +70,10 @@ uint32_t PrintJobRecovery::cmd_sdpos, // = 0
   #include "fwretract.h"
 #endif
 
+#if ENABLED(POWER_LOSS_JOURNAL)
+  #include "../libs/crc16.h"
+#endif
+
 #define DEBUG_OUT ENABLED(DEBUG_POWER_LOSS_RECOVERY)
 #include "../core/debug_out.h"
 
@@ -127,6 +139,7 @@ bool PrintJobRecovery::check() {
  */
 void PrintJobRecovery::purge() {
   init();
+  TERN_(POWER_LOSS_JOURNAL, journal_block = 0); // Its blocks are freed with the file
   card.removeJobRecoveryFile();
 }
 
@@ -135,6 +148,9 @@ void PrintJobRecovery::purge() {
  */
 void PrintJobRecovery::load() {
   if (exists()) {
+    #if ENABLED(POWER_LOSS_JOURNAL)
+      if (journal_load()) { debug(F("Load")); return; }
+    #endif
     open(true);
     (void)file.read(&info, sizeof(info));
     close();
@@ -148,6 +164,10 @@ void PrintJobRecovery::load() {
 void PrintJobRecovery::prepare() {
   card.getAbsFilenameInCWD(info.sd_filename);  // SD filename
   cmd_sdpos = 0;
+  #if ENABLED(POWER_LOSS_JOURNAL)
+    journal_block = 0;                         // Find the journal again on the next save
+    journal_off = false;
+  #endif
 }
 
 /**
@@ -333,6 +353,14 @@ void PrintJobRecovery::write() {
 
   debug(F("Write"));
 
+  #if ENABLED(POWER_LOSS_JOURNAL)
+    if (!journal_off) {
+      if (journal_write()) return;
+      journal_off = true;
+      DEBUG_ECHOLNPGM("Power-loss journal unavailable.");
+    }
+  #endif
+
   open(false);
   file.seekSet(0);
   const int16_t ret = file.write(&info, sizeof(info));
@@ -340,6 +368,169 @@ void PrintJobRecovery::write() {
   if (!file.close()) DEBUG_ECHOLNPGM("Power-loss file close failed.");
 }
 
+#if ENABLED(POWER_LOSS_JOURNAL)
+
+  /**
+   * The journal is a contiguous file of whole SD blocks, written directly
+   * through the disk driver so each save is a single block write with no
+   * FAT or directory update:
+   *
+   *   Blocks 0-1 : Two copies of the full recovery info, written alternately,
+   *                each tagged with an epoch that counts up on every write.
+   *   Blocks 2-n : A ring of compact records holding the fields that change
+   *                while printing, tagged with the epoch of their header.
+   *
+   * A new header is written only when something outside the record changes.
+   * On load the newest valid header is taken, then the newest valid record
+   * of the same epoch is applied over it.
+   */
+  #define JOURNAL_HEADS 2
+  #define JOURNAL_BYTES (512UL * (JOURNAL_HEADS + POWER_LOSS_JOURNAL_SIZE))
+
+  typedef struct {
+    uint32_t epoch;
+    job_recovery_info_t info;
+    uint16_t crc;
+  } journal_head_t;
+
+  typedef struct {
+    uint32_t epoch, seq;
+    uint32_t sdpos;
+    xyze_pos_t current_position;
+    uint16_t feedrate;
+    float zraise;
+    bool raised;
+    millis_t print_job_elapsed;
+    #if HAS_HOTEND
+      celsius_t target_temperature[HOTENDS];
+    #endif
+    #if HAS_HEATED_BED
+      celsius_t target_temperature_bed;
+    #endif
+    #if HAS_FAN
+      uint8_t fan_speed[FAN_COUNT];
+    #endif
+    uint16_t crc;
+  } journal_rec_t;
+
+  static_assert(sizeof(journal_head_t) <= 512, "job_recovery_info_t is too large for POWER_LOSS_JOURNAL.");
+
+  // Copy the journaled fields between the recovery info and a record
+  static void journal_record(job_recovery_info_t &info, journal_rec_t &rec, const bool to_rec) {
+    #define _JCOPY(F) do{ if (to_rec) memcpy(&rec.F, &info.F, sizeof(rec.F)); else memcpy(&info.F, &rec.F, sizeof(rec.F)); }while(0)
+    _JCOPY(current_position);
+    _JCOPY(feedrate);
+    _JCOPY(zraise);
+    _JCOPY(print_job_elapsed);
+    TERN_(HAS_HOTEND, _JCOPY(target_temperature));
+    TERN_(HAS_HEATED_BED, _JCOPY(target_temperature_bed));
+    TERN_(HAS_FAN, _JCOPY(fan_speed));
+    #undef _JCOPY
+    if (to_rec) { rec.sdpos = info.sdpos; rec.raised = info.flag.raised; }
+    else        { info.sdpos = rec.sdpos; info.flag.raised = rec.raised; }
+  }
+
+  // CRC of the info fields that only a header can save
+  static uint16_t journal_fixed_crc(const job_recovery_info_t &info) {
+    job_recovery_info_t fixed;
+    memcpy(&fixed, (const void*)&info, sizeof(fixed));
+    journal_rec_t rec;
+    memset(&rec, 0, sizeof(rec));
+    journal_record(fixed, rec, false);
+    fixed.valid_head = fixed.valid_foot = 0;
+    uint16_t crc = 0;
+    crc16(&crc, &fixed, sizeof(fixed));
+    return crc;
+  }
+
+  static bool journal_head_ok(const journal_head_t &head) {
+    uint16_t crc = 0;
+    crc16(&crc, &head, offsetof(journal_head_t, crc));
+    return crc == head.crc && head.info.valid_head && head.info.valid_head == head.info.valid_foot;
+  }
+
+  static bool journal_rec_ok(const journal_rec_t &rec, const uint32_t epoch) {
+    uint16_t crc = 0;
+    crc16(&crc, &rec, offsetof(journal_rec_t, crc));
+    return crc == rec.crc && rec.epoch == epoch;
+  }
+
+  // Get the latest valid header epoch, and its info if 'into' is given
+  static uint32_t journal_newest(const uint32_t block, uint32_t (&buf)[128], job_recovery_info_t * const into=nullptr) {
+    const journal_head_t &head = *(journal_head_t*)buf;
+    uint32_t epoch = 0;
+    for (uint8_t h = 0; h < JOURNAL_HEADS; ++h)
+      if (card.diskIODriver()->readBlock(block + h, (uint8_t*)buf) && journal_head_ok(head) && head.epoch > epoch) {
+        epoch = head.epoch;
+        if (into) *into = head.info;
+      }
+    return epoch;
+  }
+
+  /**
+   * Save the recovery info to the journal. Return 'false' if there's no journal.
+   */
+  bool PrintJobRecovery::journal_write() {
+    uint32_t buf[128]; // One SD block, word-aligned for DMA
+
+    if (!journal_block) {
+      journal_block = card.jobRecoveryJournal(JOURNAL_BYTES, true);
+      if (!journal_block) return false;
+      journal_epoch = journal_newest(journal_block, buf);  // Continue past any stale headers
+      journal_seq = 0;
+    }
+
+    memset(buf, 0, sizeof(buf));
+
+    const uint16_t fixed_crc = journal_fixed_crc(info);
+    if (fixed_crc != journal_crc || !journal_seq) {
+      // Header: the full info, over the older of the two copies
+      journal_head_t &head = *(journal_head_t*)buf;
+      head.epoch = ++journal_epoch;
+      head.info = info;
+      crc16(&head.crc, &head, offsetof(journal_head_t, crc));
+      if (!card.diskIODriver()->writeBlock(journal_block + (journal_epoch % JOURNAL_HEADS), (uint8_t*)buf)) return false;
+      journal_crc = fixed_crc;
+      journal_seq = 1;
+    }
+    else {
+      // Record: the changing fields, in the next slot of the ring
+      journal_rec_t &rec = *(journal_rec_t*)buf;
+      rec.epoch = journal_epoch;
+      rec.seq = ++journal_seq;
+      journal_record(info, rec, true);
+      crc16(&rec.crc, &rec, offsetof(journal_rec_t, crc));
+      if (!card.diskIODriver()->writeBlock(journal_block + JOURNAL_HEADS + (journal_seq % (POWER_LOSS_JOURNAL_SIZE)), (uint8_t*)buf)) return false;
+    }
+    return true;
+  }
+
+  /**
+   * Load the recovery info from the journal. Return 'false' if the
+   * recovery file isn't a journal, so it can be read as a plain file.
+   */
+  bool PrintJobRecovery::journal_load() {
+    const uint32_t block = card.jobRecoveryJournal(JOURNAL_BYTES, false);
+    if (!block) return false;
+
+    uint32_t buf[128];
+    init();
+    const uint32_t epoch = journal_newest(block, buf, &info);
+    if (!epoch) return true;  // A journal with nothing to resume
+
+    journal_rec_t &rec = *(journal_rec_t*)buf;
+    uint32_t seq = 0;
+    for (uint8_t r = 0; r < POWER_LOSS_JOURNAL_SIZE; ++r)
+      if (card.diskIODriver()->readBlock(block + JOURNAL_HEADS + r, (uint8_t*)buf) && journal_rec_ok(rec, epoch) && rec.seq > seq) {
+        seq = rec.seq;
+        journal_record(info, rec, false);
+      }
+
+    return true;
+  }
+
+#endif // POWER_LOSS_JOURNAL
+
 /**
  * Resume the saved print job
  */
@@ -215,6 +215,16 @@ class PrintJobRecovery {
   private:
     static void write();
 
+    #if ENABLED(POWER_LOSS_JOURNAL)
+      static uint32_t journal_block,  //!< First block of the journal file (0 until opened)
+                      journal_epoch,  //!< Epoch of the latest journal header
+                      journal_seq;    //!< Sequence of the latest record in the ring
+      static uint16_t journal_crc;    //!< CRC of the fields stored only in the header
+      static bool journal_off;        //!< No journal for this job. Use the plain file.
+      static bool journal_write();
+      static bool journal_load();
+    #endif
+
     #if ENABLED(BACKUP_POWER_SUPPLY)
       static void retract_and_lift(const_float_t zraise);
     #endif
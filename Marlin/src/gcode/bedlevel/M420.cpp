@@ -59,6 +59,8 @@
  *   S2        Create a simple random mesh and enable
  */
 void GcodeSuite::M420() {
+  TERN_(EEPROM_LAZY_LOAD, settings.load_deferred());
+
   const bool seen_S = parser.seen('S'),
              to_enable = seen_S ? parser.value_bool() : planner.leveling_active;
 
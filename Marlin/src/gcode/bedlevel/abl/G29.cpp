@@ -34,6 +34,10 @@
 #include "../../../module/probe.h"
 #include "../../queue.h"
 
+#if ENABLED(EEPROM_LAZY_LOAD)
+  #include "../../../module/settings.h"
+#endif
+
 #if ENABLED(AUTO_BED_LEVELING_LINEAR)
   #include "../../../libs/least_squares_fit.h"
 #endif
@@ -133,6 +137,10 @@ public:
       bed_mesh_t z_values;
     #endif
 
+    #if ENABLED(G29_ADAPTIVE_MESH)
+      float refine_threshold;   // Residual that triggers refinement. 0 = probe the full grid.
+    #endif
+
     #if ENABLED(AUTO_BED_LEVELING_LINEAR)
       int indexIntoAB[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
       float eqnAMatrix[(GRID_MAX_POINTS) * 3], // "A" matrix of the linear system of equations
@@ -147,6 +155,187 @@ public:
   constexpr int G29_State::abl_points;
 #endif
 
+#if ENABLED(G29_ADAPTIVE_MESH)
+
+  /**
+   * Adaptive refinement of the bilinear grid.
+   *
+   * The corners of a coarse lattice are probed first. In each lattice cell the
+   * center (or the edge midpoints of a narrow cell) is probed and compared to the
+   * bilinear estimate of the cell corners. Flat cells are filled by interpolation,
+   * the others are split in four and refined until the grid resolution is reached.
+   * A cell is only flat if every point probed in it or on its edges fits the
+   * estimate, so probing repeats until a refined neighbour adds no more points.
+   * Filling waits until then and follows the probed points along each edge, so
+   * flat and refined cells meet without a step.
+   */
+  class AdaptiveMesh {
+  public:
+    AdaptiveMesh(G29_State &_abl, const ProbePtRaise _raise, const bool _faux)
+      : abl(_abl), raise_after(_raise), faux(_faux), filling(false), touches(0) { ZERO(probed); }
+
+    // Return false if probing failed
+    bool probe_all() {
+      // Probe until a pass adds no points, then take the same path to fill the flat cells
+      uint16_t last_touches;
+      do {
+        last_touches = touches;
+        if (!walk()) return false;
+      } while (touches != last_touches);
+      filling = true;
+      if (!walk()) return false;
+      SERIAL_ECHOLNPGM("Adaptive mesh: ", touches, " of ", GRID_MAX_POINTS, " points probed.");
+      return true;
+    }
+
+  private:
+    G29_State &abl;
+    const ProbePtRaise raise_after;
+    const bool faux;
+    bool filling;
+    uint16_t touches;
+    uint8_t probed[(GRID_MAX_POINTS + 7) / 8];
+
+    // Refine every cell of the coarse lattice, in a zigzag
+    bool walk() {
+      const uint8_t sx = coarse_stride(GRID_MAX_POINTS_X), sy = coarse_stride(GRID_MAX_POINTS_Y),
+                    cells_x = ((GRID_MAX_POINTS_X) - 1 + sx - 1) / sx;
+      bool zig = true;
+      for (uint8_t y0 = 0; y0 < (GRID_MAX_POINTS_Y) - 1; y0 += sy, zig ^= true) {
+        const uint8_t y1 = _MIN(y0 + sy, (GRID_MAX_POINTS_Y) - 1);
+        LOOP_L_N(c, cells_x) {
+          const uint8_t x0 = (zig ? c : cells_x - 1 - c) * sx,
+                        x1 = _MIN(x0 + sx, (GRID_MAX_POINTS_X) - 1);
+          if (!probe_point(x0, y0) || !probe_point(x1, y0) || !probe_point(x1, y1) || !probe_point(x0, y1))
+            return false;
+          if (!refine(x0, y0, x1, y1)) return false;
+        }
+      }
+      return true;
+    }
+
+    // Largest power of 2 that still leaves 3 lattice points along the axis
+    static uint8_t coarse_stride(const uint8_t n) {
+      uint8_t s = 1;
+      while (s * 4 <= n - 1) s <<= 1;
+      return s;
+    }
+
+    bool is_probed(const uint8_t x, const uint8_t y) const {
+      const uint16_t n = x * (GRID_MAX_POINTS_Y) + y;
+      return TEST(probed[n >> 3], n & 7);
+    }
+
+    bool probe_point(const uint8_t x, const uint8_t y) {
+      if (is_probed(x, y)) return true;
+
+      const xy_int8_t ind = { int8_t(x), int8_t(y) };
+      abl.probePos = abl.probe_position_lf + abl.gridSpacing * ind.asFloat();
+
+      ++touches;
+      if (abl.verbose_level) SERIAL_ECHOLNPGM("Probing mesh point ", touches, " (", x, ",", y, ").");
+      TERN_(HAS_STATUS_MESSAGE, ui.status_printf(0, F(S_FMT " %i/%i"), GET_TEXT(MSG_PROBING_POINT), int(touches), int(abl.abl_points)));
+      ui.draw_mesh_grid(x, y, abl.z_values, false);
+      idle_no_sleep();
+
+      abl.measured_z = faux ? 0.001f * random(-100, 101) : probe.probe_at_point(abl.probePos, raise_after, abl.verbose_level);
+      if (isnan(abl.measured_z)) return false;
+
+      const float z = abl.measured_z + abl.Z_offset;
+      abl.z_values[x][y] = z;
+      TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(ind, z));
+      ui.draw_mesh_grid(x, y, abl.z_values, true);
+
+      const uint16_t n = x * (GRID_MAX_POINTS_Y) + y;
+      SBI(probed[n >> 3], n & 7);
+      abl.reenable = false; // Don't re-enable after modifying the mesh
+      idle_no_sleep();
+      return true;
+    }
+
+    // Bilinear estimate at (x, y) from the corners of the cell
+    float estimate(const uint8_t x0, const uint8_t y0, const uint8_t x1, const uint8_t y1, const uint8_t x, const uint8_t y) const {
+      const float rx = float(x - x0) / (x1 - x0), ry = float(y - y0) / (y1 - y0),
+                  z00 = abl.z_values[x0][y0], z10 = abl.z_values[x1][y0],
+                  z01 = abl.z_values[x0][y1], z11 = abl.z_values[x1][y1];
+      return z00 + rx * (z10 - z00) + ry * (z01 - z00) + rx * ry * (z11 - z10 - z01 + z00);
+    }
+
+    float residual(const uint8_t x0, const uint8_t y0, const uint8_t x1, const uint8_t y1, const uint8_t x, const uint8_t y) const {
+      return ABS(abl.z_values[x][y] - estimate(x0, y0, x1, y1, x, y));
+    }
+
+    // Along a row or column, interpolate between the nearest probed points
+    float edge_x(const uint8_t x0, const uint8_t x1, const uint8_t x, const uint8_t y) const {
+      uint8_t a = x, b = x;
+      while (a > x0 && !is_probed(a, y)) --a;
+      while (b < x1 && !is_probed(b, y)) ++b;
+      const float za = abl.z_values[a][y];
+      return a == b ? za : za + (abl.z_values[b][y] - za) * (x - a) / (b - a);
+    }
+    float edge_y(const uint8_t y0, const uint8_t y1, const uint8_t x, const uint8_t y) const {
+      uint8_t a = y, b = y;
+      while (a > y0 && !is_probed(x, a)) --a;
+      while (b < y1 && !is_probed(x, b)) ++b;
+      const float za = abl.z_values[x][a];
+      return a == b ? za : za + (abl.z_values[x][b] - za) * (y - a) / (b - a);
+    }
+
+    // Blend of the four cell edges (a Coons patch), matching every edge exactly
+    float fill_z(const uint8_t x0, const uint8_t y0, const uint8_t x1, const uint8_t y1, const uint8_t x, const uint8_t y) const {
+      const float rx = float(x - x0) / (x1 - x0), ry = float(y - y0) / (y1 - y0);
+      return (1 - rx) * edge_y(y0, y1, x0, y) + rx * edge_y(y0, y1, x1, y)
+           + (1 - ry) * edge_x(x0, x1, x, y0) + ry * edge_x(x0, x1, x, y1)
+           - estimate(x0, y0, x1, y1, x, y);
+    }
+
+    bool refine(const uint8_t x0, const uint8_t y0, const uint8_t x1, const uint8_t y1) {
+      const bool split_x = x1 - x0 > 1, split_y = y1 - y0 > 1;
+      if (!split_x && !split_y) return true;
+
+      const uint8_t xm = (x0 + x1) / 2, ym = (y0 + y1) / 2;
+
+      // Probe the test point(s)
+      if (split_x && split_y) {
+        if (!probe_point(xm, ym)) return false;
+      }
+      else if (split_x) {
+        if (!probe_point(xm, y0) || !probe_point(xm, y1)) return false;
+      }
+      else if (!probe_point(x0, ym) || !probe_point(x1, ym)) return false;
+
+      // Measure how far the cell is from flat, including points probed by neighbours
+      float err = 0;
+      for (uint8_t x = x0; x <= x1; ++x)
+        for (uint8_t y = y0; y <= y1; ++y)
+          if (is_probed(x, y)) NOLESS(err, residual(x0, y0, x1, y1, x, y));
+
+      if (err <= abl.refine_threshold) {
+        // Flat enough. Once all probing is done, fill the points that weren't probed.
+        if (filling)
+          for (uint8_t x = x0; x <= x1; ++x)
+            for (uint8_t y = y0; y <= y1; ++y)
+              if (!is_probed(x, y)) {
+                const float z = fill_z(x0, y0, x1, y1, x, y);
+                abl.z_values[x][y] = z;
+                TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(x, y, z));
+              }
+        return true;
+      }
+
+      if (abl.verbose_level > 1 && !filling) SERIAL_ECHOLNPGM("Refine cell ", x0, ",", y0, " - ", x1, ",", y1, " residual ", err);
+
+      if (split_x && split_y) {
+        if (!probe_point(xm, y0) || !probe_point(x1, ym) || !probe_point(xm, y1) || !probe_point(x0, ym)) return false;
+        return refine(x0, y0, xm, ym) && refine(xm, y0, x1, ym) && refine(xm, ym, x1, y1) && refine(x0, ym, xm, y1);
+      }
+      if (split_x) return refine(x0, y0, xm, y1) && refine(xm, y0, x1, y1);
+      return refine(x0, y0, x1, ym) && refine(x0, ym, x1, y1);
+    }
+  };
+
+#endif // G29_ADAPTIVE_MESH
+
 /**
  * G29: Detailed Z probe, probes the bed at 3 or more points.
  *      Will fail if the printer has not been homed with G28.
@@ -200,6 +389,9 @@ public:
  *
  *  Z  Supply an additional Z probe offset
  *
+ *  K  Adaptive probing. Refine the grid only where the residual exceeds K (mm).
+ *     Requires G29_ADAPTIVE_MESH. Without a value G29_ADAPTIVE_THRESHOLD is used.
+ *
  * Extra parameters with PROBE_MANUALLY:
  *
  *  To do manual probing simply repeat G29 until the procedure is complete.
@@ -223,10 +415,16 @@ public:
  *  E  By default G29 will engage the Z probe, test the bed, then disengage.
  *     Include "E" to engage/disengage the Z probe for each sample.
  *     There's no extra effect if you have a fixed Z probe.
+ *
+ * With FAST_MESH_SCAN each row is scanned in a single move at the S speed,
+ * reading the bed distance sensor on the fly.
  */
 G29_TYPE GcodeSuite::G29() {
   DEBUG_SECTION(log_G29, "G29", DEBUGGING(LEVELING));
 
+  // Read the stored mesh before reporting or changing it
+  TERN_(EEPROM_LAZY_LOAD, settings.load_deferred());
+
   // Leveling state is persistent when done manually with multiple G29 commands
   TERN_(PROBE_MANUALLY, static) G29_State abl;
 
@@ -386,6 +584,10 @@ G29_TYPE GcodeSuite::G29() {
 
       abl.Z_offset = parser.linearval('Z');
 
+      #if ENABLED(G29_ADAPTIVE_MESH)
+        abl.refine_threshold = parser.seen('K') ? (parser.has_value() ? parser.value_linear_units() : G29_ADAPTIVE_THRESHOLD) : 0;
+      #endif
+
     #endif
 
     #if ABL_USES_GRID
@@ -673,6 +875,17 @@ G29_TYPE GcodeSuite::G29() {
       ui.goto_screen((screenFunc_t) ui.g29_leveling_screen);
       bool zig = PR_OUTER_SIZE & 1;  // Always end at RIGHT and BACK_PROBE_BED_POSITION
 
+      #if ENABLED(G29_ADAPTIVE_MESH)
+        if (abl.refine_threshold > 0) {
+          AdaptiveMesh adaptive(abl, raise_after, faux);
+          if (!adaptive.probe_all()) {
+            set_bed_leveling_enabled(abl.reenable);
+            ui.g29_leveling_screen_complete(false);
+          }
+        }
+        else
+      #endif
+
       // Outer loop is X with PROBE_Y_FIRST enabled
       // Outer loop is Y with PROBE_Y_FIRST disabled
       for (PR_OUTER_VAR = 0; PR_OUTER_VAR < PR_OUTER_SIZE && !isnan(abl.measured_z); PR_OUTER_VAR++) {
@@ -695,6 +908,40 @@ G29_TYPE GcodeSuite::G29() {
         // An index to print current state
         uint8_t pt_index = (PR_OUTER_VAR) * (PR_INNER_SIZE) + 1;
 
+        #if ENABLED(FAST_MESH_SCAN)
+          if (!faux) {
+            // Sweep the whole row (or column) in one move, sampling on the fly
+            PR_INNER_VAR = inStart;
+            const xy_pos_t line_start = abl.probe_position_lf + abl.gridSpacing * abl.meshCount.asFloat();
+            PR_INNER_VAR = inStop - inInc;
+            const xy_pos_t line_end = abl.probe_position_lf + abl.gridSpacing * abl.meshCount.asFloat();
+
+            if (abl.verbose_level) SERIAL_ECHOLNPGM("Scanning mesh line ", PR_OUTER_VAR + 1, "/", PR_OUTER_SIZE, ".");
+            TERN_(HAS_STATUS_MESSAGE, ui.status_printf(0, F(S_FMT " %i/%i"), GET_TEXT(MSG_PROBING_POINT), int(pt_index), int(abl.abl_points)));
+            idle_no_sleep();
+
+            float line_z[_MAX(GRID_MAX_POINTS_X, GRID_MAX_POINTS_Y)];
+            if (probe.scan_line(line_start, line_end, PR_INNER_SIZE, line_z)) {
+              abl.measured_z = NAN;
+              set_bed_leveling_enabled(abl.reenable);
+              ui.g29_leveling_screen_complete(false);
+              break;
+            }
+
+            uint8_t i = 0;
+            for (PR_INNER_VAR = inStart; PR_INNER_VAR != inStop; PR_INNER_VAR += inInc) {
+              const float z = line_z[i++] + abl.Z_offset;
+              abl.z_values[abl.meshCount.x][abl.meshCount.y] = z;
+              TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(abl.meshCount, z));
+              ui.draw_mesh_grid(abl.meshCount.x, abl.meshCount.y, abl.z_values, true);
+            }
+            abl.measured_z = line_z[i - 1];
+            abl.reenable = false; // Don't re-enable after modifying the mesh
+            idle_no_sleep();
+            continue;
+          }
+        #endif
+
         // Inner loop is Y with PROBE_Y_FIRST enabled
         // Inner loop is X with PROBE_Y_FIRST disabled
         for (PR_INNER_VAR = inStart; PR_INNER_VAR != inStop; pt_index++, PR_INNER_VAR += inInc) {
@@ -31,6 +31,10 @@
 #include "../../gcode.h"
 #include "../../../feature/bedlevel/bedlevel.h"
 
+#if ENABLED(EEPROM_LAZY_LOAD)
+  #include "../../../module/settings.h"
+#endif
+
 #if ENABLED(EXTENSIBLE_UI)
   #include "../../../lcd/extui/ui_api.h"
 #endif
@@ -47,6 +51,8 @@
  *  - If both I and J are omitted, set all
  */
 void GcodeSuite::M421() {
+  TERN_(EEPROM_LAZY_LOAD, settings.load_deferred());
+
   int8_t ix = parser.intval('I', -1), iy = parser.intval('J', -1);
   const bool hasZ = parser.seenval('Z'),
              hasQ = !hasZ && parser.seenval('Q');
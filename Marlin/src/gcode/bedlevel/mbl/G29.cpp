@@ -38,6 +38,10 @@
 #include "../../../module/motion.h"
 #include "../../../module/planner.h"
 
+#if ENABLED(EEPROM_LAZY_LOAD)
+  #include "../../../module/settings.h"
+#endif
+
 #if ENABLED(EXTENSIBLE_UI)
   #include "../../../lcd/extui/ui_api.h"
 #elif ENABLED(DWIN_LCD_PROUI)
@@ -66,6 +70,9 @@ inline void echo_not_entered(const char c) { SERIAL_CHAR(c); SERIAL_ECHOLNPGM("
 void GcodeSuite::G29() {
   DEBUG_SECTION(log_G29, "G29", true);
 
+  // Read the stored mesh before reporting or changing it
+  TERN_(EEPROM_LAZY_LOAD, settings.load_deferred());
+
   // G29 Q is also available if debugging
   #if ENABLED(DEBUG_LEVELING_FEATURE)
     const bool seenQ = parser.seen_test('Q');
@@ -32,6 +32,10 @@
 #include "../../../module/motion.h"
 #include "../../../feature/bedlevel/mbl/mesh_bed_leveling.h"
 
+#if ENABLED(EEPROM_LAZY_LOAD)
+  #include "../../../module/settings.h"
+#endif
+
 /**
  * M421: Set a single Mesh Bed Leveling Z coordinate
  *
@@ -42,6 +46,8 @@
  *   M421 I<xindex> J<yindex> Q<offset>
  */
 void GcodeSuite::M421() {
+  TERN_(EEPROM_LAZY_LOAD, settings.load_deferred());
+
   const bool hasX = parser.seen('X'), hasI = parser.seen('I');
   const int8_t ix = hasI ? parser.value_int() : hasX ? bedlevel.probe_index_x(RAW_X_POSITION(parser.value_linear_units())) : -1;
   const bool hasY = parser.seen('Y'), hasJ = parser.seen('J');
@@ -44,6 +44,7 @@
  * G3   - CCW ARC
  * G4   - Dwell S<seconds> or P<milliseconds>
  * G5   - Cubic B-spline with XYZE destination and IJPQ offsets
+ * G7   - Laser raster run with per-pixel power (Requires LASER_RASTER)
  * G10  - Retract filament according to settings of M207 (Requires FWRETRACT)
  * G11  - Retract recover filament according to settings of M208 (Requires FWRETRACT)
  * G12  - Clean tool (Requires NOZZLE_CLEAN_FEATURE)
@@ -66,6 +67,7 @@
  * G42  - Coordinated move to a mesh point (Requires MESH_BED_LEVELING, AUTO_BED_LEVELING_BLINEAR, or AUTO_BED_LEVELING_UBL)
  * G60  - Save current position. (Requires SAVED_POSITIONS)
  * G61  - Apply/restore saved coordinates. (Requires SAVED_POSITIONS)
+ * G64  - Blend corners between G0/G1 moves within P<mm>. P0 for the exact path. (Requires PATH_BLENDING)
  * G76  - Calibrate first layer temperature offsets. (Requires PTC_PROBE and PTC_BED)
  * G80  - Cancel current motion mode (Requires GCODE_MOTION_MODES)
  * G90  - Use Absolute Coordinates
@@ -497,6 +499,10 @@ private:
     static void G6();
   #endif
 
+  #if ENABLED(LASER_RASTER)
+    static void G7();
+  #endif
+
   #if ENABLED(FWRETRACT)
     static void G10();
     static void G11();
@@ -591,6 +597,10 @@ private:
     static void G61();
   #endif
 
+  #if ENABLED(PATH_BLENDING)
+    static void G64();
+  #endif
+
   #if ENABLED(GCODE_MOTION_MODES)
     static void G80();
   #endif
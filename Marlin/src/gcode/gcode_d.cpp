@@ -38,6 +38,25 @@
 #include "../sd/cardreader.h"
 #include "../MarlinCore.h" // for kill
 
+#if HAS_MESH
+  #include "../feature/bedlevel/bedlevel.h"
+#endif
+
+#if HAS_GRAPHICAL_TFT
+  #include "../lcd/tft/tft.h"
+#endif
+
+#ifdef KINEMATIC_SEGMENT_TOLERANCE
+  #include "../module/motion.h"
+  #if ENABLED(DELTA)
+    #include "../module/delta.h"
+  #elif ENABLED(POLARGRAPH)
+    #include "../module/polargraph.h"
+  #elif IS_SCARA
+    #include "../module/scara.h"
+  #endif
+#endif
+
 void dump_delay_accuracy_check();
 
 /**
@@ -184,6 +203,69 @@ void GcodeSuite::D(const int16_t dcode) {
       SERIAL_ECHOLN(gtn(&SERIAL_IMPL));
       break;
 
+    #if HAS_MESH
+      case 8: { // D8 Benchmark mesh Z correction. C<count> S<segment length>
+        const uint16_t count = parser.ushortval('C', 10000);
+        const float seg = parser.floatval('S', 0.5f);
+        // Serpentine over the bed in short segments, as a leveled kinematic move would be split
+        xy_pos_t pos = { X_MIN_POS, Y_MIN_POS };
+        float step = seg, sum = 0;
+        const uint32_t start = micros();
+        for (uint16_t i = count; i--;) {
+          sum += bedlevel.get_z_correction(pos);
+          pos.x += step;
+          if (!WITHIN(pos.x, X_MIN_POS, X_MAX_POS)) {
+            step = -step;
+            pos.x += step;
+            pos.y += 5;
+            if (pos.y > Y_MAX_POS) pos.y = Y_MIN_POS;
+          }
+        }
+        const uint32_t us = micros() - start;
+        SERIAL_ECHOLNPGM("D8 ", count, " corrections in ", us, "us = ", us ? count * 1000000.0f / us : 0.0f, " segments/s (sum ", sum, ")");
+      } break;
+    #endif
+
+    #ifdef KINEMATIC_SEGMENT_TOLERANCE
+      case 9: { // D9 Benchmark kinematic segmentation. C<moves> F<feedrate mm/s>
+        const uint16_t count = parser.ushortval('C', 100);
+        const float fr_mm_s = parser.floatval('F', 100);
+        auto random_point = []{
+          xyz_pos_t p = current_position;
+          do { p.x = random(X_MIN_POS, X_MAX_POS); p.y = random(Y_MIN_POS, Y_MAX_POS); } while (!position_is_reachable(p));
+          return p;
+        };
+        float total_mm = 0;
+        uint32_t fixed = 0, adaptive = 0, us = 0;
+        for (uint16_t n = count; n--;) {
+          const xyz_pos_t a = random_point(), b = random_point();
+          const float mm = (b - a).magnitude();
+          const uint16_t segments = _MAX(1U, uint16_t(segments_per_second * mm / fr_mm_s));
+          const xyz_float_t segment_distance = (b - a) / float(segments);
+          total_mm += mm;
+          fixed += segments;
+          // Same loop as line_to_destination_kinematic, without the planner
+          const uint32_t start = micros();
+          abce_pos_t joints;
+          inverse_kinematics(a);
+          joints = delta;
+          for (uint16_t i = 0, span = segments; i < segments; i += span, adaptive++)
+            span = kinematic_segment_span(a, segment_distance, i, segments, span, joints);
+          us += micros() - start;
+        }
+        SERIAL_ECHOLNPGM("D9 ", count, " moves, ", total_mm, "mm: fixed ", fixed / total_mm, " segments/mm, adaptive ", adaptive / total_mm, " segments/mm in ", us, "us");
+      } break;
+    #endif
+
+    #if HAS_GRAPHICAL_TFT
+      case 11: // D11 Report TFT bytes sent since the last D11. S1 / S0 to report each frame.
+        if (parser.seenval('S'))
+          tft.queue.frame_report = parser.value_bool();
+        else
+          tft.queue.report_frames();
+        break;
+    #endif
+
     case 100: { // D100 Disable heaters and attempt a hard hang (Watchdog Test)
       SERIAL_ECHOLNPGM("Disabling heaters and attempting to trigger Watchdog");
       SERIAL_ECHOLNPGM("(USE_WATCHDOG " TERN(USE_WATCHDOG, "ENABLED", "DISABLED") ")");
@@ -200,7 +282,7 @@ void GcodeSuite::D(const int16_t dcode) {
 
     #if ENABLED(SDSUPPORT)
 
-      case 101: { // D101 Test SD Write
+      case 101: { // D101 Test SD Write. S<chunk size> to time upload-sized writes
         card.openFileWrite("test.gco");
         if (!card.isFileOpen()) {
           SERIAL_ECHOLNPGM("Failed to open test.gco to write.");
@@ -212,13 +294,19 @@ void GcodeSuite::D(const int16_t dcode) {
         for (c = 0; c < COUNT(buf); c++)
           buf[c] = 'A' + (c % ('Z' - 'A'));
 
-        c = 1024 * 4;
-        while (c--) {
+        // The same 2MB, in chunks the size of M28 lines or binary transfer packets
+        const uint16_t chunk = constrain(parser.ushortval('S', COUNT(buf)), 1, COUNT(buf));
+        const millis_t start_ms = millis();
+        uint32_t pos = 0;
+        while (pos < 2048UL * 1024UL) {
           hal.watchdog_refresh();
-          card.write(buf, COUNT(buf));
+          const uint16_t o = pos % COUNT(buf), n = _MIN(chunk, uint16_t(COUNT(buf) - o));
+          card.write(&buf[o], n);
+          pos += n;
         }
-        SERIAL_ECHOLNPGM(" done");
         card.closefile();
+        const millis_t ms = millis() - start_ms;
+        SERIAL_ECHOLNPGM(" done in ", ms, "ms (", ms ? pos / ms : pos, " kB/s)");
       } break;
 
       case 102: { // D102 Test SD Read
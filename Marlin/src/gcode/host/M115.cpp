@@ -196,6 +196,9 @@ void GcodeSuite::M115() {
     // EXTENDED_M20 (M20 L)
     cap_line(F("EXTENDED_M20"), ENABLED(LONG_FILENAME_HOST_SUPPORT));
 
+    // PAGED_M20 (M20 S C H K)
+    cap_line(F("PAGED_M20"), ENABLED(M20_PAGED_LISTING));
+
     // THERMAL_PROTECTION
     cap_line(F("THERMAL_PROTECTION"), ENABLED(THERMALLY_SAFE));
 
@@ -31,6 +31,10 @@
 
 #include "../../sd/cardreader.h"
 
+#if ENABLED(PATH_BLENDING)
+  #include "../../feature/path_blend.h"
+#endif
+
 #if ENABLED(NANODLP_Z_SYNC)
   #include "../../module/planner.h"
 #endif
@@ -107,7 +111,9 @@ void GcodeSuite::G0_G1(TERN_(HAS_FAST_MOVES, const bool fast_move/*=false*/)) {
     #endif // FWRETRACT
 
     #if IS_SCARA
-      fast_move ? prepare_fast_move_to_destination() : prepare_line_to_destination();
+      fast_move ? prepare_fast_move_to_destination() : TERN(PATH_BLENDING, path_blend.line_to_destination(), prepare_line_to_destination());
+    #elif ENABLED(PATH_BLENDING)
+      path_blend.line_to_destination();
     #else
       prepare_line_to_destination();
     #endif
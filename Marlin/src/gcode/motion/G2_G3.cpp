@@ -222,6 +222,102 @@ void plan_arc(
     hints.inv_duration = (scaled_fr_mm_s / flat_mm) * segments;
   #endif
 
+  #if ENABLED(ARC_NATIVE_BLOCKS)
+    /**
+     * Let the stepper trace XY arcs exactly. The arc is only split where one of the
+     * XY motors reverses, so each block keeps its direction bits, and at
+     * ARC_NATIVE_SEGMENT_MM so leveling can follow the bed.
+     */
+    if (axis_p == X_AXIS) {
+      const float start_angle = ATAN2(rvec.b, rvec.a),
+                  max_piece = (ARC_NATIVE_SEGMENT_MM) / _MAX(radius, 0.001f);
+      const bool ccw = angular_travel > 0;
+
+      hints.arc_center.set(center_P, center_Q);
+      const float limiting_accel = _MIN(planner.settings.max_acceleration_mm_per_s2[axis_p], planner.settings.max_acceleration_mm_per_s2[axis_q]);
+
+      xyze_pos_t raw = current_position;
+      float angle_done = 0;
+      millis_t next_idle_ms = millis() + 200UL;
+
+      while (angle_done < abs_angular_travel) {
+        thermalManager.task();
+        const millis_t ms = millis();
+        if (ELAPSED(ms, next_idle_ms)) { next_idle_ms = ms + 200UL; idle(); }
+
+        // Angle to the next motor reversal in the direction of travel
+        const float a = start_angle + (ccw ? angle_done : -angle_done),
+                    k = a / (ARC_REVERSAL_ANGLE);
+        float to_reversal = ccw ? (FLOOR(k) + 1) * (ARC_REVERSAL_ANGLE) - a : a - (CEIL(k) - 1) * (ARC_REVERSAL_ANGLE);
+        if (to_reversal < 0.0001f) to_reversal += ARC_REVERSAL_ANGLE;
+
+        float piece = _MIN(to_reversal, max_piece);
+        if (abs_angular_travel - (angle_done + piece) < 0.0001f) piece = abs_angular_travel - angle_done;
+        angle_done += piece;
+
+        const bool is_last = angle_done >= abs_angular_travel;
+        const float fraction = is_last ? 1.0f : angle_done / abs_angular_travel,
+                    end_angle = start_angle + (ccw ? angle_done : -angle_done);
+
+        raw[axis_p] = center_P + radius * cos(end_angle);
+        raw[axis_q] = center_Q + radius * sin(end_angle);
+
+        // The last piece ends at the destination, unless that lies off the circle
+        if (is_last) {
+          if (HYPOT(cart[axis_p] - raw[axis_p], cart[axis_q] - raw[axis_q]) < 0.01f)
+            raw = cart;
+          else {
+            ARC_LIJKUVWE_CODE(
+              raw[axis_l] = cart[axis_l], raw.i = cart.i, raw.j = cart.j, raw.k = cart.k,
+              raw.u = cart.u, raw.v = cart.v, raw.w = cart.w, raw.e = cart.e
+            );
+          }
+        }
+        else {
+          ARC_LIJKUVWE_CODE(
+            raw[axis_l] = start_L + travel_L * fraction,
+            raw.i = start_I + travel_I * fraction, raw.j = start_J + travel_J * fraction, raw.k = start_K + travel_K * fraction,
+            raw.u = start_U + travel_U * fraction, raw.v = start_V + travel_V * fraction, raw.w = start_W + travel_W * fraction,
+            raw.e = current_position.e + travel_E * fraction
+          );
+        }
+
+        xyze_pos_t leveled = raw;
+        apply_motion_limits(leveled);
+
+        #if HAS_LEVELING && !PLANNER_LEVELING
+          planner.apply_leveling(leveled);
+        #endif
+
+        hints.arc_angle = ccw ? piece : -piece;
+        hints.millimeters = HYPOT(radius * piece, TERN0(HAS_Z_AXIS, travel_L * piece / abs_angular_travel));
+        hints.safe_exit_speed_sqr = is_last ? 0.0f : _MIN(sq(scaled_fr_mm_s), 2 * limiting_accel * radius * (abs_angular_travel - angle_done));
+
+        // The planner only refuses a move while it's being flushed (quickstop, print abort),
+        // so drop the rest of the arc rather than finishing it as a straight line.
+        if (!planner.buffer_line(leveled, scaled_fr_mm_s, active_extruder, hints)) {
+          current_position = cart;
+          return;
+        }
+
+        hints.curve_radius = radius;
+      }
+
+      // Go straight to a destination off the circle
+      if (raw != cart) {
+        raw = cart;
+        apply_motion_limits(raw);
+        #if HAS_LEVELING && !PLANNER_LEVELING
+          planner.apply_leveling(raw);
+        #endif
+        planner.buffer_line(raw, scaled_fr_mm_s, active_extruder);
+      }
+
+      current_position = cart;
+      return;
+    }
+  #endif
+
   /**
    * Vector rotation by transformation matrix: r is the original vector, r_T is the rotated vector,
    * and phi is the angle of rotation. Based on the solution approach by Jens Geisler.
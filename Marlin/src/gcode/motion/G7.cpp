@@ -0,0 +1,114 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(LASER_RASTER)
+
+#include "../gcode.h"
+#include "../../module/motion.h"
+#include "../../module/planner.h"
+#include "../../feature/spindle_laser.h"
+
+#include "../../MarlinCore.h" // for IsRunning()
+
+/**
+ * Decode base64 pixel data, stopping at the end, a space, or '=' padding.
+ * Return the number of pixels, or -1 if the data is bad or too long.
+ */
+static int16_t decode_pixels(const char *str, uint8_t (&pixels)[LASER_RASTER_PIXELS]) {
+  int16_t count = 0;
+  uint16_t bits = 0;
+  uint8_t nbits = 0;
+  for (; *str && *str != ' ' && *str != '='; ++str) {
+    const char c = *str;
+    uint8_t v;
+    if (WITHIN(c, 'A', 'Z'))      v = c - 'A';
+    else if (WITHIN(c, 'a', 'z')) v = c - 'a' + 26;
+    else if (NUMERIC(c))          v = c - '0' + 52;
+    else if (c == '+')            v = 62;
+    else if (c == '/')            v = 63;
+    else return -1;
+    bits = (bits << 6) | v;
+    nbits += 6;
+    if (nbits >= 8) {
+      if (count >= LASER_RASTER_PIXELS) return -1;
+      nbits -= 8;
+      pixels[count++] = uint8_t(bits >> nbits);
+      bits &= _BV(nbits) - 1;
+    }
+  }
+  return count;
+}
+
+/**
+ * G7: Laser raster run
+ *
+ * Move in a straight line while the laser steps through a run of pixel
+ * powers, spaced evenly from the start of the move to its end.
+ * Requires continuous inline mode (M3 I).
+ *
+ *   X Y Z    - Destination, as with G1
+ *   F        - Feedrate
+ *   S        - Power of a full (255) pixel, as with G1 S
+ *   $<data>  - Pixel values 0-255 as base64. Must be the last parameter.
+ *
+ * Example: G7 X20 F6000 S100 $AIBA/w
+ */
+void GcodeSuite::G7() {
+  if (!IsRunning()) return;
+
+  if (cutter.cutter_mode != CUTTER_MODE_CONTINUOUS) {
+    SERIAL_ERROR_MSG("G7 requires inline laser mode (M3 I).");
+    return;
+  }
+
+  uint8_t pixels[LASER_RASTER_PIXELS];
+  const int16_t count = parser.string_arg ? decode_pixels(parser.string_arg, pixels) : 0;
+  if (count <= 0) {
+    SERIAL_ERROR_MSG("G7 needs 1-" STRINGIFY(LASER_RASTER_PIXELS) " base64 pixels after '$'.");
+    return;
+  }
+
+  get_destination_from_command();   // X Y Z F and the inline S power
+  apply_motion_limits(destination);
+
+  // Scale the pixels to the S power so the ISR only has to copy them out
+  const uint8_t full = planner.laser_inline.power;
+  LOOP_L_N(i, count) pixels[i] = uint16_t(pixels[i]) * full / 255;
+
+  PlannerHints hints;
+  hints.raster_power = pixels;
+  hints.raster_pixels = count;
+
+  // A single block carries the whole run, so leveling only applies at the ends
+  xyze_pos_t raw = destination;
+  #if HAS_LEVELING && !PLANNER_LEVELING
+    planner.apply_leveling(raw);
+  #endif
+  planner.buffer_line(raw, MMS_SCALED(feedrate_mm_s), active_extruder, hints);
+
+  current_position = destination;
+  reset_stepper_timeout();
+}
+
+#endif // LASER_RASTER
@@ -303,6 +303,16 @@ void GCodeParser::parse(char *p) {
       return;
     }
 
+    // Special handling for G7 ... $<pixels>
+    // The base64 pixel data must be the last parameter
+    #if ENABLED(LASER_RASTER)
+      if (param == '$' && is_command('G', 7)) {
+        p[-1] = '\0';                            // Hide the data from seen()
+        string_arg = p;                           // Pixels start after '$'
+        return;
+      }
+    #endif
+
     #if ENABLED(GCODE_QUOTED_STRINGS)
       if (!quoted_string_arg && param == '"') {
         quoted_string_arg = true;
@@ -38,13 +38,35 @@
  *
  * With M20_TIMESTAMP_SUPPORT:
  *   T<bool> - Include timestamps
+ *
+ * With M20_PAGED_LISTING:
+ *   S<offset> - Skip this many files
+ *   C<count>  - List up to this many files, then "More files at S<next>" if more remain
+ *   H<bool>   - Compact listing. Each folder is given once as "<path>/ <token>" followed by its file names.
+ *               The folder token changes whenever any of its files change.
+ *   K<token>  - Report the token for the whole listing, and skip the listing if it matches
  */
 void GcodeSuite::M20() {
   if (card.flag.mounted) {
     SERIAL_ECHOLNPGM(STR_BEGIN_FILE_LIST);
-    card.ls(TERN0(CUSTOM_FIRMWARE_UPLOAD,     parser.boolval('F') << LS_ONLY_BIN)
-          | TERN0(LONG_FILENAME_HOST_SUPPORT, parser.boolval('L') << LS_LONG_FILENAME)
-          | TERN0(M20_TIMESTAMP_SUPPORT,      parser.boolval('T') << LS_TIMESTAMP));
+    const uint8_t lsflags = TERN0(CUSTOM_FIRMWARE_UPLOAD,     parser.boolval('F') << LS_ONLY_BIN)
+                          | TERN0(LONG_FILENAME_HOST_SUPPORT, parser.boolval('L') << LS_LONG_FILENAME)
+                          | TERN0(M20_TIMESTAMP_SUPPORT,      parser.boolval('T') << LS_TIMESTAMP)
+                          | TERN0(M20_PAGED_LISTING,          parser.boolval('H') << LS_COMPACT);
+    #if ENABLED(M20_PAGED_LISTING)
+      const bool tokened = parser.seen('K');
+      const uint32_t token = tokened ? card.listingToken() : 0;
+      if (tokened && parser.value_ulong() == token)
+        SERIAL_ECHOLNPGM(STR_FILE_LIST_UNCHANGED);
+      else {
+        const uint16_t offset = parser.ushortval('S'), count = parser.ushortval('C');
+        card.ls(lsflags, offset, count);
+        if (card.lsMore()) SERIAL_ECHOLNPGM(STR_FILE_LIST_MORE, offset + count);
+      }
+      if (tokened) SERIAL_ECHOLNPGM(STR_FILE_LIST_TOKEN, token);
+    #else
+      card.ls(lsflags);
+    #endif
     SERIAL_ECHOLNPGM(STR_END_FILE_LIST);
   }
   else
@@ -995,6 +995,34 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
       #warning "SDSORT_CACHE_VFATS was reduced to MAX_VFAT_ENTRIES!"
     #endif
   #endif
+
+  #if ENABLED(SDSORT_BACKGROUND)
+    #if ENABLED(SDSORT_USES_RAM)
+      #error "SDSORT_BACKGROUND keeps its own sort keys and can't be used with SDSORT_USES_RAM."
+    #elif SDSORT_KEY_LEN < 4
+      #error "SDSORT_KEY_LEN should be 4 or greater to be useful."
+    #elif !defined(SDSORT_SLICE_MS) || SDSORT_SLICE_MS < 1
+      #error "SDSORT_SLICE_MS must be 1 or greater."
+    #elif BOTH(SDSORT_FILE_INDEX, SDCARD_READONLY)
+      #error "SDSORT_FILE_INDEX can't be used with SDCARD_READONLY."
+    #endif
+  #endif
+#endif
+
+#if ENABLED(SD_MULTIBLOCK_WRITE)
+  #if ENABLED(SDCARD_READONLY)
+    #error "SD_MULTIBLOCK_WRITE can't be used with SDCARD_READONLY."
+  #elif !WITHIN(SD_WRITE_BUFFER_BLOCKS, 2, 16)
+    #error "SD_WRITE_BUFFER_BLOCKS must be from 2 to 16."
+  #endif
+#endif
+
+#ifdef HEATSHRINK_WINDOW_BITS
+  #if !WITHIN(HEATSHRINK_WINDOW_BITS, 4, 15)
+    #error "HEATSHRINK_WINDOW_BITS must be from 4 to 15."
+  #elif !WITHIN(HEATSHRINK_LOOKAHEAD_BITS, 3, HEATSHRINK_WINDOW_BITS - 1)
+    #error "HEATSHRINK_LOOKAHEAD_BITS must be from 3 to HEATSHRINK_WINDOW_BITS - 1."
+  #endif
 #endif
 
 #if defined(EVENT_GCODE_SD_ABORT) && DISABLED(NOZZLE_PARK_FEATURE)
@@ -1221,6 +1249,14 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
     #endif
   #endif
 
+  #if ENABLED(TOOLCHANGE_PREHEAT)
+    #if !HAS_MULTI_HOTEND
+      #error "TOOLCHANGE_PREHEAT requires HOTENDS > 1."
+    #elif ENABLED(SDSUPPORT) && !(TOOLCHANGE_PREHEAT_LOOKAHEAD >= 512)
+      #error "TOOLCHANGE_PREHEAT_LOOKAHEAD must be at least 512 bytes."
+    #endif
+  #endif
+
   #ifndef TOOLCHANGE_ZRAISE
     #error "TOOLCHANGE_ZRAISE required for EXTRUDERS > 1."
   #endif
@@ -1674,6 +1710,24 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
   #endif
 #endif
 
+#ifdef DELTA_IK_BATCH
+  #if DISABLED(DELTA)
+    #error "DELTA_IK_BATCH requires DELTA."
+  #elif defined(KINEMATIC_SEGMENT_TOLERANCE)
+    #error "DELTA_IK_BATCH is not compatible with KINEMATIC_SEGMENT_TOLERANCE."
+  #elif !WITHIN(DELTA_IK_BATCH, 2, 32)
+    #error "DELTA_IK_BATCH must be between 2 and 32."
+  #endif
+#endif
+
+#if ENABLED(STREAMING_SEGMENTS)
+  #if !(IS_KINEMATIC || ENABLED(SEGMENT_LEVELED_MOVES))
+    #error "STREAMING_SEGMENTS requires DELTA, SCARA, or SEGMENT_LEVELED_MOVES."
+  #elif !WITHIN(STREAMING_SEGMENTS_PER_LOOP, 1, 255)
+    #error "STREAMING_SEGMENTS_PER_LOOP must be between 1 and 255."
+  #endif
+#endif
+
 /**
  * Junction deviation is incompatible with kinematic systems.
  */
@@ -2041,6 +2095,27 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
   #endif
 #endif
 
+#if ENABLED(FAST_MESH_SCAN)
+  #if DISABLED(BD_SENSOR)
+    #error "FAST_MESH_SCAN requires BD_SENSOR."
+  #elif DISABLED(AUTO_BED_LEVELING_BILINEAR)
+    #error "FAST_MESH_SCAN requires AUTO_BED_LEVELING_BILINEAR."
+  #elif IS_KINEMATIC
+    #error "FAST_MESH_SCAN is not compatible with DELTA, SCARA, or POLARGRAPH."
+  #endif
+#endif
+
+#if ENABLED(G29_ADAPTIVE_MESH)
+  #if DISABLED(AUTO_BED_LEVELING_BILINEAR)
+    #error "G29_ADAPTIVE_MESH requires AUTO_BED_LEVELING_BILINEAR."
+  #elif ENABLED(PROBE_MANUALLY)
+    #error "G29_ADAPTIVE_MESH is not compatible with PROBE_MANUALLY."
+  #elif IS_KINEMATIC
+    #error "G29_ADAPTIVE_MESH is not compatible with DELTA, SCARA, or POLARGRAPH."
+  #endif
+  static_assert(G29_ADAPTIVE_THRESHOLD > 0, "G29_ADAPTIVE_THRESHOLD must be greater than 0.");
+#endif
+
 #if ENABLED(G29_RETRY_AND_RECOVER) && NONE(AUTO_BED_LEVELING_3POINT, AUTO_BED_LEVELING_LINEAR, AUTO_BED_LEVELING_BILINEAR)
   #error "G29_RETRY_AND_RECOVER requires AUTO_BED_LEVELING_3POINT, LINEAR, or BILINEAR."
 #endif
@@ -2820,6 +2895,67 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
   #error "ENDSTOP_NOISE_THRESHOLD must be an integer from 2 to 7."
 #endif
 
+#if ENABLED(ENDSTOP_EDGE_CAPTURE)
+  #if IS_KINEMATIC
+    #error "ENDSTOP_EDGE_CAPTURE is not yet supported for kinematic machines."
+  #elif DISABLED(ENDSTOP_INTERRUPTS_FEATURE)
+    #error "ENDSTOP_EDGE_CAPTURE requires ENDSTOP_INTERRUPTS_FEATURE."
+  #endif
+#endif
+
+/**
+ * Native arc blocks
+ */
+#if ENABLED(ARC_NATIVE_BLOCKS)
+  #if defined(__AVR__)
+    #error "ARC_NATIVE_BLOCKS requires a 32-bit processor."
+  #elif DISABLED(ARC_SUPPORT)
+    #error "ARC_NATIVE_BLOCKS requires ARC_SUPPORT."
+  #elif IS_KINEMATIC || ANY(CORE_IS_XZ, CORE_IS_YZ, MARKFORGED_XY, MARKFORGED_YX)
+    #error "ARC_NATIVE_BLOCKS requires Cartesian or CoreXY kinematics."
+  #elif ANY(SKEW_CORRECTION, BACKLASH_COMPENSATION, AUTO_BED_LEVELING_UBL)
+    #error "ARC_NATIVE_BLOCKS is incompatible with SKEW_CORRECTION, BACKLASH_COMPENSATION, and AUTO_BED_LEVELING_UBL."
+  #elif !(ARC_NATIVE_SEGMENT_MM > 0)
+    #error "ARC_NATIVE_SEGMENT_MM must be greater than 0."
+  #endif
+#endif
+
+/**
+ * Laser power by velocity
+ */
+#if ENABLED(LASER_POWER_VELOCITY)
+  #if DISABLED(LASER_FEATURE)
+    #error "LASER_POWER_VELOCITY requires LASER_FEATURE."
+  #elif ENABLED(LASER_POWER_TRAP)
+    #error "LASER_POWER_VELOCITY and LASER_POWER_TRAP are mutually exclusive."
+  #endif
+#endif
+
+/**
+ * G7 Laser Raster
+ */
+#if ENABLED(LASER_RASTER)
+  #if DISABLED(LASER_FEATURE)
+    #error "LASER_RASTER requires LASER_FEATURE."
+  #elif ENABLED(LASER_POWER_TRAP)
+    #error "LASER_RASTER is incompatible with LASER_POWER_TRAP."
+  #elif IS_KINEMATIC
+    #error "LASER_RASTER is not supported for kinematic machines."
+  #elif !WITHIN(LASER_RASTER_PIXELS, 1, 255)
+    #error "LASER_RASTER_PIXELS must be from 1 to 255."
+  #endif
+#endif
+
+/**
+ * G64 Path Blending
+ */
+#if ENABLED(PATH_BLENDING)
+  #if DISABLED(ARC_SUPPORT)
+    #error "PATH_BLENDING requires ARC_SUPPORT."
+  #endif
+  static_assert(PATH_BLENDING_TOLERANCE > 0, "PATH_BLENDING_TOLERANCE must be greater than 0.");
+#endif
+
 /**
  * Emergency Command Parser
  */
@@ -2972,6 +3108,19 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
   #endif
 #endif
 
+/**
+ * Deferred EEPROM mesh section
+ */
+#if ENABLED(EEPROM_LAZY_LOAD)
+  #if DISABLED(EEPROM_SETTINGS)
+    #error "EEPROM_LAZY_LOAD requires EEPROM_SETTINGS."
+  #elif NONE(MESH_BED_LEVELING, AUTO_BED_LEVELING_BILINEAR)
+    #error "EEPROM_LAZY_LOAD requires MESH_BED_LEVELING or AUTO_BED_LEVELING_BILINEAR."
+  #elif ANY(DWIN_LCD_PROUI, DWIN_CREALITY_LCD_JYERSUI)
+    #error "EEPROM_LAZY_LOAD is not compatible with DWIN_LCD_PROUI or DWIN_CREALITY_LCD_JYERSUI."
+  #endif
+#endif
+
 /**
  * Make sure features that need to write to the SD card can
  */
@@ -3100,6 +3249,10 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
   #endif
 #endif
 
+#if ENABLED(TFT_DIRTY_RECTS) && !WITHIN(TFT_DIRTY_RECTS_MAX, 2, 127)
+  #error "TFT_DIRTY_RECTS_MAX must be from 2 to 127."
+#endif
+
 #if defined(GRAPHICAL_TFT_UPSCALE) && !WITHIN(GRAPHICAL_TFT_UPSCALE, 2, 8)
   #error "GRAPHICAL_TFT_UPSCALE must be between 2 and 8."
 #endif
@@ -3868,7 +4021,11 @@ static_assert(_PLUS_TEST(4), "HOMING_FEEDRATE_MM_M values must be positive.");
     #error "POWER_LOSS_RECOVER_ZHOME is not needed on a machine that homes to ZMAX."
   #elif BOTH(IS_CARTESIAN, POWER_LOSS_RECOVER_ZHOME) && Z_HOME_TO_MIN && !defined(POWER_LOSS_ZHOME_POS)
     #error "POWER_LOSS_RECOVER_ZHOME requires POWER_LOSS_ZHOME_POS for a Cartesian that homes to ZMIN."
+  #elif ENABLED(POWER_LOSS_JOURNAL) && !WITHIN(POWER_LOSS_JOURNAL_SIZE, 2, 255)
+    #error "POWER_LOSS_JOURNAL_SIZE must be from 2 to 255."
   #endif
+#elif ENABLED(POWER_LOSS_JOURNAL)
+  #error "POWER_LOSS_JOURNAL requires POWER_LOSS_RECOVERY."
 #endif
 
 #if ENABLED(Z_STEPPER_AUTO_ALIGN)
@@ -86,6 +86,10 @@
   #include "../../feature/bedlevel/bedlevel.h"
 #endif
 
+#if ENABLED(EEPROM_LAZY_LOAD)
+  #include "../../module/settings.h"
+#endif
+
 #if HAS_FILAMENT_SENSOR
   #include "../../feature/runout.h"
 #endif
@@ -919,12 +923,13 @@ namespace ExtUI {
 
     #if HAS_MESH
 
-      bed_mesh_t& getMeshArray() { return bedlevel.z_values; }
-      float getMeshPoint(const xy_uint8_t &pos) { return bedlevel.z_values[pos.x][pos.y]; }
+      bed_mesh_t& getMeshArray() { TERN_(EEPROM_LAZY_LOAD, settings.load_deferred()); return bedlevel.z_values; }
+      float getMeshPoint(const xy_uint8_t &pos) { TERN_(EEPROM_LAZY_LOAD, settings.load_deferred()); return bedlevel.z_values[pos.x][pos.y]; }
       void setMeshPoint(const xy_uint8_t &pos, const_float_t zoff) {
+        TERN_(EEPROM_LAZY_LOAD, settings.load_deferred());
         if (WITHIN(pos.x, 0, (GRID_MAX_POINTS_X) - 1) && WITHIN(pos.y, 0, (GRID_MAX_POINTS_Y) - 1)) {
           bedlevel.z_values[pos.x][pos.y] = zoff;
-          TERN_(ABL_BILINEAR_SUBDIVISION, bed_level_virt_interpolate());
+          TERN_(AUTO_BED_LEVELING_BILINEAR, bedlevel.refresh_bed_level());
         }
       }
 
@@ -32,6 +32,10 @@
 #include "../../module/planner.h"
 #include "../../feature/bedlevel/bedlevel.h"
 
+#if ENABLED(EEPROM_LAZY_LOAD)
+  #include "../../module/settings.h"
+#endif
+
 #if HAS_BED_PROBE && DISABLED(BABYSTEP_ZPROBE_OFFSET)
   #include "../../module/probe.h"
 #endif
@@ -205,12 +209,14 @@
 #if ENABLED(MESH_EDIT_MENU)
 
   inline void refresh_planner() {
+    TERN_(AUTO_BED_LEVELING_BILINEAR, bedlevel.refresh_bed_level());
     set_current_from_steppers_for_axis(ALL_AXES_ENUM);
     sync_plan_position();
   }
 
   void menu_edit_mesh() {
     static uint8_t xind, yind; // =0
+    TERN_(EEPROM_LAZY_LOAD, settings.load_deferred());
     START_MENU();
     BACK_ITEM(MSG_BED_LEVELING);
     EDIT_ITEM(uint8, MSG_MESH_X, &xind, 0, (GRID_MAX_POINTS_X) - 1);
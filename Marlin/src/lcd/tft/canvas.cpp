@@ -30,22 +30,44 @@ uint16_t CANVAS::width, CANVAS::height;
 uint16_t CANVAS::startLine, CANVAS::endLine;
 uint16_t *CANVAS::buffer = TFT::buffer;
 
+#if ENABLED(TFT_DOUBLE_BUFFER)
+  // Each half of the buffer takes a slice while the other goes to the display
+  #define CANVAS_BUFFER_SIZE (TFT_BUFFER_SIZE / 2)
+  static_assert(CANVAS_BUFFER_SIZE >= TFT_WIDTH, "TFT_DOUBLE_BUFFER requires a TFT_BUFFER_SIZE of at least two display lines.");
+  static_assert(!(CANVAS_BUFFER_SIZE & 1), "TFT_DOUBLE_BUFFER requires a TFT_BUFFER_SIZE that is a multiple of 4.");
+  uint16_t CANVAS::left, CANVAS::top;
+#else
+  #define CANVAS_BUFFER_SIZE TFT_BUFFER_SIZE
+#endif
+
 void CANVAS::New(uint16_t x, uint16_t y, uint16_t width, uint16_t height) {
   CANVAS::width = width;
   CANVAS::height = height;
   startLine = 0;
   endLine = 0;
 
-  tft.set_window(x, y, x + width - 1, y + height - 1);
+  #if ENABLED(TFT_DOUBLE_BUFFER)
+    // Don't touch the display, which may still be busy with the last canvas
+    left = x;
+    top = y;
+  #else
+    tft.set_window(x, y, x + width - 1, y + height - 1);
+  #endif
 }
 
 void CANVAS::Continue() {
   startLine = endLine;
-  endLine = TFT_BUFFER_SIZE < width * (height - startLine) ? startLine + TFT_BUFFER_SIZE / width : height;
+  endLine = CANVAS_BUFFER_SIZE < width * (height - startLine) ? startLine + CANVAS_BUFFER_SIZE / width : height;
 }
 
 bool CANVAS::ToScreen() {
-  tft.write_sequence(buffer, width * (endLine - startLine));
+  #if ENABLED(TFT_DOUBLE_BUFFER)
+    if (startLine == 0) tft.set_window(left, top, left + width - 1, top + height - 1);
+    tft.write_sequence(buffer, width * (endLine - startLine));
+    buffer = buffer == TFT::buffer ? TFT::buffer + CANVAS_BUFFER_SIZE : TFT::buffer;
+  #else
+    tft.write_sequence(buffer, width * (endLine - startLine));
+  #endif
   return endLine == height;
 }
 
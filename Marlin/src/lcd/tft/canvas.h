@@ -33,6 +33,9 @@ class CANVAS {
     static uint16_t width, height;
     static uint16_t startLine, endLine;
     static uint16_t *buffer;
+    #if ENABLED(TFT_DOUBLE_BUFFER)
+      static uint16_t left, top;  // The window is set when the first slice goes out
+    #endif
 
     inline static font_t *Font() { return TFT_String::font(); }
     inline static glyph_t *Glyph(uint8_t *character) { return TFT_String::glyph(character); }
@@ -34,31 +34,62 @@ uint8_t *TFT_Queue::current_task = nullptr;
 uint8_t *TFT_Queue::last_task = nullptr;
 uint8_t *TFT_Queue::last_parameter = nullptr;
 
+#if ENABLED(TFT_DIRTY_RECTS)
+  drawnArea_t TFT_Queue::drawn[TFT_DIRTY_RECTS_MAX];
+  uint8_t TFT_Queue::next_drawn = 0;
+  uint32_t TFT_Queue::sketch_hash;
+#endif
+
+#if ENABLED(TFT_DOUBLE_BUFFER)
+  bool TFT_Queue::slice_ready = false;
+#endif
+
+#if ENABLED(MARLIN_DEV_MODE)
+  uint32_t TFT_Queue::frame_pushed = 0, TFT_Queue::frame_skipped = 0,
+           TFT_Queue::total_frames = 0, TFT_Queue::total_pushed = 0, TFT_Queue::total_skipped = 0;
+  bool TFT_Queue::frame_report = false;
+#endif
+
 void TFT_Queue::reset() {
   tft.abort();
 
+  // An aborted task leaves the screen unknown, so nothing drawn can be trusted
+  TERN_(TFT_DIRTY_RECTS, ZERO(drawn));
+
+  rewind();
+}
+
+void TFT_Queue::rewind() {
   end_of_queue = queue;
   current_task = nullptr;
   last_task = nullptr;
   last_parameter = nullptr;
+  TERN_(TFT_DOUBLE_BUFFER, slice_ready = false);
 }
 
 void TFT_Queue::async() {
   if (!current_task) return;
   queueTask_t *task = (queueTask_t *)current_task;
 
-  // Check IO busy status
-  if (tft.is_busy()) return;
+  #if DISABLED(TFT_DOUBLE_BUFFER)
+    // Check IO busy status
+    if (tft.is_busy()) return;
+  #endif
+
+  finish_sketch();
 
-  if (task->state == TASK_STATE_COMPLETED) {
+  // Step over completed tasks, and those skipped as unchanged
+  while (task->type != TASK_END_OF_QUEUE && task->state == TASK_STATE_COMPLETED)
     task = (queueTask_t *)task->nextTask;
-    current_task = (uint8_t *)task;
-  }
+  current_task = (uint8_t *)task;
 
-  finish_sketch();
+  #if ENABLED(TFT_DOUBLE_BUFFER)
+    // Only a canvas can go on while the display is busy, drawing its next slice
+    if (task->type != TASK_CANVAS && tft.is_busy()) return;
+  #endif
 
   switch (task->type) {
-    case TASK_END_OF_QUEUE: reset();      break;
+    case TASK_END_OF_QUEUE: TERN_(MARLIN_DEV_MODE, end_frame()); rewind(); break;
     case TASK_FILL:         fill(task);   break;
     case TASK_CANVAS:       canvas(task); break;
   }
@@ -73,6 +104,12 @@ void TFT_Queue::finish_sketch() {
     task->nextTask = end_of_queue;
     task->state = TASK_STATE_READY;
 
+    #if ENABLED(TFT_DIRTY_RECTS)
+      parametersCanvas_t *task_parameters = (parametersCanvas_t *)(((uint8_t *)task) + sizeof(queueTask_t));
+      if (unchanged(task_parameters->x, task_parameters->y, task_parameters->width, task_parameters->height))
+        task->state = TASK_STATE_COMPLETED;
+    #endif
+
     if (!current_task) current_task = (uint8_t *)task;
   }
 }
@@ -84,6 +121,7 @@ void TFT_Queue::fill(queueTask_t *task) {
   if (task->state == TASK_STATE_READY) {
     tft.set_window(task_parameters->x, task_parameters->y, task_parameters->x + task_parameters->width - 1, task_parameters->y + task_parameters->height - 1);
     task->state = TASK_STATE_IN_PROGRESS;
+    TERN_(MARLIN_DEV_MODE, frame_pushed += task_parameters->count * sizeof(uint16_t));
   }
 
   if (task_parameters->count > DMA_MAX_SIZE) {
@@ -108,7 +146,13 @@ void TFT_Queue::canvas(queueTask_t *task) {
   if (task->state == TASK_STATE_READY) {
     task->state = TASK_STATE_IN_PROGRESS;
     Canvas.New(task_parameters->x, task_parameters->y, task_parameters->width, task_parameters->height);
+    TERN_(MARLIN_DEV_MODE, frame_pushed += uint32_t(task_parameters->width) * task_parameters->height * sizeof(uint16_t));
   }
+
+  #if ENABLED(TFT_DOUBLE_BUFFER)
+    if (slice_ready) return send_slice(task);
+  #endif
+
   Canvas.Continue();
 
   for (i = 0; i < task_parameters->count; i++) {
@@ -139,12 +183,34 @@ void TFT_Queue::canvas(queueTask_t *task) {
     item = ((parametersCanvasBackground_t *)item)->nextParameter;
   }
 
-  if (Canvas.ToScreen()) task->state = TASK_STATE_COMPLETED;
+  #if ENABLED(TFT_DOUBLE_BUFFER)
+    slice_ready = true;
+    send_slice(task);
+  #else
+    if (Canvas.ToScreen()) task->state = TASK_STATE_COMPLETED;
+  #endif
 }
 
+#if ENABLED(TFT_DOUBLE_BUFFER)
+
+  // Send the drawn slice once the display has taken the last one
+  void TFT_Queue::send_slice(queueTask_t *task) {
+    if (tft.is_busy()) return;
+    slice_ready = false;
+    if (Canvas.ToScreen()) task->state = TASK_STATE_COMPLETED;
+  }
+
+#endif
+
 void TFT_Queue::fill(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint16_t color) {
   finish_sketch();
 
+  #if ENABLED(TFT_DIRTY_RECTS)
+    sketch_hash = 2166136261UL;
+    hash(color);
+    if (unchanged(x, y, width, height)) return;
+  #endif
+
   queueTask_t *task = (queueTask_t *)end_of_queue;
   last_task = (uint8_t *)task;
 
@@ -189,6 +255,8 @@ void TFT_Queue::canvas(uint16_t x, uint16_t y, uint16_t width, uint16_t height)
   task_parameters->height = height;
   task_parameters->count = 0;
 
+  TERN_(TFT_DIRTY_RECTS, sketch_hash = 2166136261UL);
+
   if (!current_task) current_task = (uint8_t *)task;
 }
 
@@ -204,6 +272,10 @@ void TFT_Queue::set_background(uint16_t color) {
   end_of_queue += sizeof(parametersCanvasBackground_t);
   task_parameters->count++;
   parameters->nextParameter = end_of_queue;
+
+  #if ENABLED(TFT_DIRTY_RECTS)
+    hash(parameters->type); hash(color);
+  #endif
 }
 
 #define QUEUE_SAFETY_FREE_SPACE 100
@@ -238,6 +310,11 @@ void TFT_Queue::add_text(uint16_t x, uint16_t y, uint16_t color, const uint8_t *
   parameters->nextParameter = end_of_queue;
   parameters->stringLength = pointer - string;
   task_parameters->count++;
+
+  #if ENABLED(TFT_DIRTY_RECTS)
+    hash(parameters->type); hash(x); hash(y); hash(color); hash(maxWidth);
+    hash(string, parameters->stringLength);
+  #endif
 }
 
 void TFT_Queue::add_image(int16_t x, int16_t y, MarlinImage image, uint16_t *colors) {
@@ -255,6 +332,10 @@ void TFT_Queue::add_image(int16_t x, int16_t y, MarlinImage image, uint16_t *col
   task_parameters->count++;
   parameters->nextParameter = end_of_queue;
 
+  #if ENABLED(TFT_DIRTY_RECTS)
+    hash(parameters->type); hash(x); hash(y); hash(image);
+  #endif
+
   colorMode_t color_mode = Images[image].colorMode;
 
   if (color_mode == HIGHCOLOR) return;
@@ -269,6 +350,8 @@ void TFT_Queue::add_image(int16_t x, int16_t y, MarlinImage image, uint16_t *col
     default: break;
   }
 
+  TERN_(TFT_DIRTY_RECTS, hash(colors, color_count * sizeof(uint16_t)));
+
   uint16_t tmp;
   while (color_count--) {
     tmp = *colors++;
@@ -331,6 +414,10 @@ void TFT_Queue::add_bar(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
   end_of_queue += sizeof(parametersCanvasBar_t);
   task_parameters->count++;
   parameters->nextParameter = end_of_queue;
+
+  #if ENABLED(TFT_DIRTY_RECTS)
+    hash(parameters->type); hash(x); hash(y); hash(width); hash(height); hash(color);
+  #endif
 }
 
 void TFT_Queue::add_rectangle(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint16_t color) {
@@ -349,6 +436,68 @@ void TFT_Queue::add_rectangle(uint16_t x, uint16_t y, uint16_t width, uint16_t h
   end_of_queue += sizeof(parametersCanvasRectangle_t);
   task_parameters->count++;
   parameters->nextParameter = end_of_queue;
+
+  #if ENABLED(TFT_DIRTY_RECTS)
+    hash(parameters->type); hash(x); hash(y); hash(width); hash(height); hash(color);
+  #endif
 }
 
+#if ENABLED(TFT_DIRTY_RECTS)
+
+  // FNV-1a, over everything that goes into the sketch
+  void TFT_Queue::hash(const void *data, uint16_t length) {
+    const uint8_t *byte = (const uint8_t *)data;
+    while (length--) sketch_hash = (sketch_hash ^ *byte++) * 16777619UL;
+  }
+
+  /**
+   * Check whether an area would be drawn exactly as it is now on screen.
+   * If not, remember it as drawn and forget any areas it covers over.
+   */
+  bool TFT_Queue::unchanged(uint16_t x, uint16_t y, uint16_t width, uint16_t height) {
+    for (uint8_t i = 0; i < TFT_DIRTY_RECTS_MAX; i++) {
+      const drawnArea_t &area = drawn[i];
+      if (area.x == x && area.y == y && area.width == width && area.height == height && area.hash == sketch_hash) {
+        TERN_(MARLIN_DEV_MODE, frame_skipped += uint32_t(width) * height * sizeof(uint16_t));
+        return true;
+      }
+    }
+
+    int8_t slot = -1;
+    for (uint8_t i = 0; i < TFT_DIRTY_RECTS_MAX; i++) {
+      drawnArea_t &area = drawn[i];
+      if (area.width && area.x < x + width && x < area.x + area.width && area.y < y + height && y < area.y + area.height)
+        area.width = 0;
+      if (!area.width && slot < 0) slot = i;
+    }
+
+    // With no free slot, take each slot in turn
+    if (slot < 0) {
+      slot = next_drawn;
+      next_drawn = (next_drawn + 1) % (TFT_DIRTY_RECTS_MAX);
+    }
+
+    drawn[slot] = { x, y, width, height, sketch_hash };
+    return false;
+  }
+
+#endif // TFT_DIRTY_RECTS
+
+#if ENABLED(MARLIN_DEV_MODE)
+
+  void TFT_Queue::end_frame() {
+    if (frame_report) SERIAL_ECHOLNPGM("TFT frame pushed:", frame_pushed, " skipped:", frame_skipped);
+    total_frames++;
+    total_pushed += frame_pushed;
+    total_skipped += frame_skipped;
+    frame_pushed = frame_skipped = 0;
+  }
+
+  void TFT_Queue::report_frames() {
+    SERIAL_ECHOLNPGM("TFT frames:", total_frames, " pushed:", total_pushed, " skipped:", total_skipped);
+    total_frames = total_pushed = total_skipped = 0;
+  }
+
+#endif // MARLIN_DEV_MODE
+
 #endif // HAS_GRAPHICAL_TFT
@@ -118,6 +118,17 @@ typedef struct __attribute__((__packed__)) {
   uint16_t color;
 } parametersCanvasRectangle_t;
 
+#if ENABLED(TFT_DIRTY_RECTS)
+  // An area of the screen and a hash of what was last drawn there
+  typedef struct {
+    uint16_t x;
+    uint16_t y;
+    uint16_t width;
+    uint16_t height;
+    uint32_t hash;
+  } drawnArea_t;
+#endif
+
 class TFT_Queue {
   private:
     static uint8_t queue[TFT_QUEUE_SIZE];
@@ -126,12 +137,37 @@ class TFT_Queue {
     static uint8_t *last_task;
     static uint8_t *last_parameter;
 
+    static void rewind();
     static void finish_sketch();
     static void fill(queueTask_t *task);
     static void canvas(queueTask_t *task);
     static void handle_queue_overflow(uint16_t sizeNeeded);
 
+    #if ENABLED(TFT_DIRTY_RECTS)
+      static drawnArea_t drawn[TFT_DIRTY_RECTS_MAX];
+      static uint8_t next_drawn;
+      static uint32_t sketch_hash;
+      static void hash(const void *data, uint16_t length);
+      template<typename T> static void hash(const T &value) { hash(&value, sizeof(T)); }
+      static bool unchanged(uint16_t x, uint16_t y, uint16_t width, uint16_t height);
+    #endif
+
+    #if ENABLED(TFT_DOUBLE_BUFFER)
+      static bool slice_ready;  // A canvas slice is drawn and waiting for the display
+      static void send_slice(queueTask_t *task);
+    #endif
+
+    #if ENABLED(MARLIN_DEV_MODE)
+      static uint32_t frame_pushed, frame_skipped, total_frames, total_pushed, total_skipped;
+      static void end_frame();
+    #endif
+
   public:
+    #if ENABLED(MARLIN_DEV_MODE)
+      static bool frame_report;  // Report the bytes sent for each frame
+      static void report_frames();
+    #endif
+
     static void reset();
     static void async();
     static void sync() { while (current_task != nullptr) async(); }
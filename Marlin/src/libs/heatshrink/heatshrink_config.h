@@ -15,8 +15,13 @@
 #else
   // Required parameters for static configuration
   #define HEATSHRINK_STATIC_INPUT_BUFFER_SIZE 32
-  #define HEATSHRINK_STATIC_WINDOW_BITS 8
-  #define HEATSHRINK_STATIC_LOOKAHEAD_BITS 4
+  #ifdef HEATSHRINK_WINDOW_BITS
+    #define HEATSHRINK_STATIC_WINDOW_BITS HEATSHRINK_WINDOW_BITS
+    #define HEATSHRINK_STATIC_LOOKAHEAD_BITS HEATSHRINK_LOOKAHEAD_BITS
+  #else
+    #define HEATSHRINK_STATIC_WINDOW_BITS 8
+    #define HEATSHRINK_STATIC_LOOKAHEAD_BITS 4
+  #endif
 #endif
 
 // Turn on logging for debugging
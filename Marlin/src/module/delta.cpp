@@ -124,6 +124,28 @@ void inverse_kinematics(const xyz_pos_t &raw) {
   #endif
 }
 
+#ifdef DELTA_IK_BATCH
+
+  /**
+   * Inverse kinematics for 'n' points at once, with the results in 'a', 'b', 'c'.
+   * Each tower gets its own pass over the points. The iterations don't depend on
+   * each other, so the FPU can pipeline the square roots (or the compiler vectorize them).
+   */
+  void inverse_kinematics_batch(const uint8_t n, const float x[], const float y[], const float z[], float a[], float b[], float c[]) {
+    float * const tower_z[ABC] = { a, b, c };
+    LOOP_ABC(t) {
+      // Delta hotend offsets must be applied in Cartesian space with no "spoofing"
+      const float tx = delta_tower[t].x + TERN0(HAS_HOTEND_OFFSET, hotend_offset[active_extruder].x),
+                  ty = delta_tower[t].y + TERN0(HAS_HOTEND_OFFSET, hotend_offset[active_extruder].y),
+                  rod2 = delta_diagonal_rod_2_tower[t];
+      float * const out = tower_z[t];
+      for (uint8_t i = 0; i < n; ++i)
+        out[i] = z[i] + SQRT(rod2 - HYPOT2(tx - x[i], ty - y[i]));
+    }
+  }
+
+#endif
+
 /**
  * Calculate the highest Z position where the
  * effector has the full range of XY motion.
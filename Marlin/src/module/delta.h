@@ -83,6 +83,10 @@ void recalc_delta_settings();
 
 void inverse_kinematics(const xyz_pos_t &raw);
 
+#ifdef DELTA_IK_BATCH
+  void inverse_kinematics_batch(const uint8_t n, const float x[], const float y[], const float z[], float a[], float b[], float c[]);
+#endif
+
 /**
  * Calculate the highest Z position where the
  * effector has the full range of XY motion.
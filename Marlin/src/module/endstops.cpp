@@ -1012,6 +1012,40 @@ void Endstops::update() {
     #endif
   #endif
 
+  #if ENABLED(ENDSTOP_EDGE_CAPTURE)
+    // Latch the step counts on a new trigger, ahead of any noise filtering.
+    // Only endstops on the axes moving in this block can stop it.
+    endstop_mask_t edge_mask = 0;
+    #define _EDGE(A,N) do{ if (stepper.axis_is_moving(_AXIS(A))) SBI(edge_mask, N); }while(0)
+    #define _EDGE_MIN_MAX(A) TERN_(HAS_##A##_MIN, _EDGE(A, A##_MIN)); TERN_(HAS_##A##_MAX, _EDGE(A, A##_MAX));
+    MAIN_AXIS_MAP(_EDGE_MIN_MAX)
+    #if ENABLED(X_DUAL_ENDSTOPS)
+      TERN_(HAS_X_MIN, _EDGE(X, X2_MIN)); TERN_(HAS_X_MAX, _EDGE(X, X2_MAX));
+    #endif
+    #if ENABLED(Y_DUAL_ENDSTOPS)
+      TERN_(HAS_Y_MIN, _EDGE(Y, Y2_MIN)); TERN_(HAS_Y_MAX, _EDGE(Y, Y2_MAX));
+    #endif
+    #if ENABLED(Z_MULTI_ENDSTOPS)
+      TERN_(HAS_Z_MIN, _EDGE(Z, Z2_MIN)); TERN_(HAS_Z_MAX, _EDGE(Z, Z2_MAX));
+      #if NUM_Z_STEPPERS >= 3
+        TERN_(HAS_Z_MIN, _EDGE(Z, Z3_MIN)); TERN_(HAS_Z_MAX, _EDGE(Z, Z3_MAX));
+      #endif
+      #if NUM_Z_STEPPERS >= 4
+        TERN_(HAS_Z_MIN, _EDGE(Z, Z4_MIN)); TERN_(HAS_Z_MAX, _EDGE(Z, Z4_MAX));
+      #endif
+    #endif
+    TERN_(HAS_BED_PROBE, _EDGE(Z, Z_MIN_PROBE));
+    #if HAS_G38_PROBE
+      if (G38_move) SBI(edge_mask, _ENDSTOP(Z, TERN(USES_Z_MIN_PROBE_PIN, MIN_PROBE, MIN)));
+    #endif
+    #undef _EDGE
+    #undef _EDGE_MIN_MAX
+
+    static endstop_mask_t edge_live_state;
+    if (live_state & ~edge_live_state & edge_mask) stepper.capture_position();
+    edge_live_state = live_state;
+  #endif
+
   #if ENDSTOP_NOISE_THRESHOLD
 
     /**
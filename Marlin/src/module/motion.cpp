@@ -1057,6 +1057,48 @@ FORCE_INLINE void segment_idle(millis_t &next_idle_ms) {
     #define SCARA_MIN_SEGMENT_LENGTH 0.5f
   #endif
 
+  #ifdef KINEMATIC_SEGMENT_TOLERANCE
+
+    #if IS_SCARA
+      // Joint angles in degrees, converted to mm at the end of the arm
+      #define SEGMENT_JOINT_MM RADIANS(TERN(AXEL_TPARA, TPARA_LINKAGE_1 + TPARA_LINKAGE_2, SCARA_LINKAGE_1 + SCARA_LINKAGE_2))
+    #else
+      #define SEGMENT_JOINT_MM 1.0f
+    #endif
+
+    /**
+     * Get the number of fixed segments, starting at segment 'i', that can be joined into
+     * a single move. The span is halved until the joints at its midpoint deviate from
+     * linear interpolation by no more than KINEMATIC_SEGMENT_TOLERANCE.
+     *
+     * 'joints' holds the joint position at the start, and is advanced to the end of the span.
+     * 'prev_span' is the last result. The span may double on each call.
+     */
+    uint16_t kinematic_segment_span(const xyz_pos_t &start, const xyz_float_t &segment_distance, const uint16_t i, const uint16_t segments, const uint16_t prev_span, abce_pos_t &joints) {
+      constexpr float tolerance = (KINEMATIC_SEGMENT_TOLERANCE) * 0.001f;
+      const xyz_pos_t a = start + segment_distance * float(i);
+      uint16_t span = _MIN(segments - i, prev_span * 2);
+      for (;;) {
+        const xyz_pos_t b = start + segment_distance * float(i + span);
+        inverse_kinematics(b);
+        const abce_pos_t jb = delta;
+        if (span > 1) {
+          inverse_kinematics((a + b) * 0.5f);
+          const float da = ABS(delta.a - (joints.a + jb.a) * 0.5f),
+                      db = ABS(delta.b - (joints.b + jb.b) * 0.5f),
+                      dc = ABS(delta.c - (joints.c + jb.c) * 0.5f);
+          if (_MAX(da, db) * (SEGMENT_JOINT_MM) > tolerance || dc * TERN(AXEL_TPARA, SEGMENT_JOINT_MM, 1.0f) > tolerance) {
+            span >>= 1;
+            continue;
+          }
+        }
+        joints = jb;
+        return span;
+      }
+    }
+
+  #endif // KINEMATIC_SEGMENT_TOLERANCE
+
   /**
    * Prepare a linear move in a DELTA or SCARA setup.
    *
@@ -1114,7 +1156,6 @@ FORCE_INLINE void segment_idle(millis_t &next_idle_ms) {
 
     // The approximate length of each segment
     const float inv_segments = 1.0f / float(segments);
-    const xyze_float_t segment_distance = diff * inv_segments;
 
     // Add hints to help optimize the move
     PlannerHints hints(cartesian_mm * inv_segments);
@@ -1128,20 +1169,71 @@ FORCE_INLINE void segment_idle(millis_t &next_idle_ms) {
     SERIAL_EOL();
     //*/
 
-    // Get the current position as starting point
-    xyze_pos_t raw = current_position;
+    #if ENABLED(STREAMING_SEGMENTS)
 
-    // Calculate and execute the segments
-    millis_t next_idle_ms = millis() + 200UL;
-    while (--segments) {
-      segment_idle(next_idle_ms);
-      raw += segment_distance;
-      if (!planner.buffer_line(raw, scaled_fr_mm_s, active_extruder, hints))
-        break;
-    }
+      // Leave the segments for idle() to buffer
+      segment_stream.start(destination, segments, scaled_fr_mm_s, hints.millimeters);
+
+    #else
+
+      const xyze_float_t segment_distance = diff * inv_segments;
+
+      // Get the current position as starting point
+      xyze_pos_t raw = current_position;
+
+      // Calculate and execute the segments
+      millis_t next_idle_ms = millis() + 200UL;
+
+      #ifdef KINEMATIC_SEGMENT_TOLERANCE
+
+        // Join segments where the joint paths are nearly straight
+        const float segment_mm = hints.millimeters;
+        abce_pos_t joints;
+        inverse_kinematics(raw);
+        joints = delta;
+        for (uint16_t i = 0, span = segments;;) {
+          span = kinematic_segment_span(current_position, segment_distance, i, segments, span, joints);
+          i += span;
+          hints.millimeters = segment_mm * span;
+          TERN_(SCARA_FEEDRATE_SCALING, hints.inv_duration = scaled_fr_mm_s / hints.millimeters);
+          if (i >= segments) break;
+          segment_idle(next_idle_ms);
+          raw = current_position + segment_distance * float(i);
+          if (!planner.buffer_line(raw, scaled_fr_mm_s, active_extruder, hints))
+            break;
+        }
+
+      #elif defined(DELTA_IK_BATCH)
+
+        // Buffer the segments in batches, with one inverse kinematics pass for each
+        xyze_pos_t batch[DELTA_IK_BATCH];
+        for (uint16_t remaining = segments - 1; remaining;) {
+          segment_idle(next_idle_ms);
+          const uint8_t count = _MIN(remaining, uint16_t(DELTA_IK_BATCH));
+          LOOP_L_N(i, count) {
+            raw += segment_distance;
+            batch[i] = raw;
+          }
+          if (planner.buffer_lines(batch, count, scaled_fr_mm_s, active_extruder, hints) < count)
+            break;
+          remaining -= count;
+        }
+
+      #else
+
+        while (--segments) {
+          segment_idle(next_idle_ms);
+          raw += segment_distance;
+          if (!planner.buffer_line(raw, scaled_fr_mm_s, active_extruder, hints))
+            break;
+        }
+
+      #endif
 
-    // Ensure last segment arrives at target location.
-    planner.buffer_line(destination, scaled_fr_mm_s, active_extruder, hints);
+      // Ensure last segment arrives at target location.
+      planner.buffer_line(destination, scaled_fr_mm_s, active_extruder, hints);
+
+    #endif // !STREAMING_SEGMENTS
 
     return false; // caller will update current_position
   }
@@ -1181,7 +1273,6 @@ FORCE_INLINE void segment_idle(millis_t &next_idle_ms) {
 
       // The approximate length of each segment
       const float inv_segments = 1.0f / float(segments);
-      const xyze_float_t segment_distance = diff * inv_segments;
 
       // Add hints to help optimize the move
       PlannerHints hints(cartesian_mm * inv_segments);
@@ -1191,21 +1282,32 @@ FORCE_INLINE void segment_idle(millis_t &next_idle_ms) {
       //SERIAL_ECHOLNPGM(" segments=", segments);
       //SERIAL_ECHOLNPGM(" segment_mm=", hints.millimeters);
 
-      // Get the raw current position as starting point
-      xyze_pos_t raw = current_position;
+      #if ENABLED(STREAMING_SEGMENTS)
 
-      // Calculate and execute the segments
-      millis_t next_idle_ms = millis() + 200UL;
-      while (--segments) {
-        segment_idle(next_idle_ms);
-        raw += segment_distance;
-        if (!planner.buffer_line(raw, fr_mm_s, active_extruder, hints))
-          break;
-      }
+        // Leave the segments for idle() to buffer
+        segment_stream.start(destination, segments, fr_mm_s, hints.millimeters);
+
+      #else
+
+        const xyze_float_t segment_distance = diff * inv_segments;
+
+        // Get the raw current position as starting point
+        xyze_pos_t raw = current_position;
+
+        // Calculate and execute the segments
+        millis_t next_idle_ms = millis() + 200UL;
+        while (--segments) {
+          segment_idle(next_idle_ms);
+          raw += segment_distance;
+          if (!planner.buffer_line(raw, fr_mm_s, active_extruder, hints))
+            break;
+        }
+
+        // Since segment_distance is only approximate,
+        // the final move must be to the exact destination.
+        planner.buffer_line(destination, fr_mm_s, active_extruder, hints);
 
-      // Since segment_distance is only approximate,
-      // the final move must be to the exact destination.
-      planner.buffer_line(destination, fr_mm_s, active_extruder, hints);
+      #endif
     }
 
   #endif // SEGMENT_LEVELED_MOVES && !AUTO_BED_LEVELING_UBL
@@ -1255,6 +1357,154 @@ FORCE_INLINE void segment_idle(millis_t &next_idle_ms) {
 
 #endif // !IS_KINEMATIC
 
+#if ENABLED(STREAMING_SEGMENTS)
+
+  SegmentStream segment_stream;
+
+  xyze_pos_t SegmentStream::start_pos, SegmentStream::target;
+  xyze_float_t SegmentStream::segment_distance;
+  uint16_t SegmentStream::segments, SegmentStream::index;
+  feedRate_t SegmentStream::fr_mm_s;
+  float SegmentStream::segment_mm;
+  uint8_t SegmentStream::extruder;
+  bool SegmentStream::buffering; // = false
+  #ifdef KINEMATIC_SEGMENT_TOLERANCE
+    abce_pos_t SegmentStream::joints;
+    uint16_t SegmentStream::span;
+  #endif
+
+  struct SegmentStream::block_state_t {
+    #if ENABLED(LASER_FEATURE)
+      laser_state_t laser;
+    #endif
+    #if HAS_FAN
+      uint8_t fan_speed[FAN_COUNT];
+    #endif
+    #if HAS_EXTRUDERS
+      float e_factor;
+    #endif
+  };
+  SegmentStream::block_state_t SegmentStream::state;
+
+  /**
+   * Exchange the captured block state with the live one. The next G-code may
+   * already have changed laser power, fans or flow before the stream finishes.
+   */
+  void SegmentStream::swap_state() {
+    #if ENABLED(LASER_FEATURE)
+      const laser_state_t laser = planner.laser_inline;
+      planner.laser_inline = state.laser;
+      state.laser = laser;
+    #endif
+    #if HAS_FAN
+      FANS_LOOP(f) {
+        const uint8_t s = thermalManager.fan_speed[f];
+        thermalManager.fan_speed[f] = state.fan_speed[f];
+        state.fan_speed[f] = s;
+      }
+    #endif
+    #if HAS_EXTRUDERS
+      const float e = planner.e_factor[extruder];
+      planner.e_factor[extruder] = state.e_factor;
+      state.e_factor = e;
+    #endif
+  }
+
+  /**
+   * Begin streaming the segments of a move from current_position to 'target'
+   */
+  void SegmentStream::start(const xyze_pos_t &in_target, const uint16_t in_segments, const_feedRate_t in_fr_mm_s, const_float_t in_segment_mm) {
+    finish();
+    start_pos = current_position;
+    target = in_target;
+    segments = in_segments;
+    segment_distance = (target - start_pos) / float(segments);
+    fr_mm_s = in_fr_mm_s;
+    segment_mm = in_segment_mm;
+    extruder = active_extruder;
+    index = 0;
+    TERN_(LASER_FEATURE, state.laser = planner.laser_inline);
+    TERN_(HAS_FAN, COPY(state.fan_speed, thermalManager.fan_speed));
+    TERN_(HAS_EXTRUDERS, state.e_factor = planner.e_factor[extruder]);
+    #ifdef KINEMATIC_SEGMENT_TOLERANCE
+      inverse_kinematics(start_pos);
+      joints = delta;
+      span = segments;
+    #endif
+    advance();
+  }
+
+  /**
+   * Buffer the next segment, span of segments, or batch of segments.
+   * The caller makes sure the planner has room.
+   */
+  bool SegmentStream::buffer_next() {
+    PlannerHints hints(segment_mm);
+    bool ok;
+    buffering = true;
+    swap_state();
+
+    #ifdef KINEMATIC_SEGMENT_TOLERANCE
+
+      span = kinematic_segment_span(start_pos, segment_distance, index, segments, span, joints);
+      index += span;
+      hints.millimeters = segment_mm * span;
+      TERN_(SCARA_FEEDRATE_SCALING, hints.inv_duration = fr_mm_s / hints.millimeters);
+      ok = planner.buffer_line(index < segments ? start_pos + segment_distance * float(index) : target, fr_mm_s, extruder, hints);
+
+    #else
+
+      TERN_(SCARA_FEEDRATE_SCALING, hints.inv_duration = fr_mm_s / hints.millimeters);
+
+      #ifdef DELTA_IK_BATCH
+        // Up to a batch of the segments ahead of the last one
+        const uint8_t count = _MIN(segments - 1 - index, uint16_t(DELTA_IK_BATCH), uint16_t(planner.moves_free()));
+        if (count) {
+          xyze_pos_t batch[DELTA_IK_BATCH];
+          LOOP_L_N(i, count) batch[i] = start_pos + segment_distance * float(index + 1 + i);
+          ok = planner.buffer_lines(batch, count, fr_mm_s, extruder, hints) == count;
+          index += count;
+          swap_state();
+          buffering = false;
+          return ok;
+        }
+      #endif
+
+      // The last segment goes exactly to the target
+      ++index;
+      ok = planner.buffer_line(index < segments ? start_pos + segment_distance * float(index) : target, fr_mm_s, extruder, hints);
+
+    #endif
+
+    swap_state();
+    buffering = false;
+    return ok;
+  }
+
+  /**
+   * Called from idle() to buffer a few segments while the planner has room
+   */
+  void SegmentStream::advance() {
+    if (buffering) return;
+    for (uint8_t n = STREAMING_SEGMENTS_PER_LOOP; n && active() && planner.moves_free(); --n)
+      if (!buffer_next()) abort();
+  }
+
+  /**
+   * Buffer all the remaining segments, waiting for the planner as needed
+   */
+  void SegmentStream::finish() {
+    if (buffering) return;
+    while (active()) {
+      if (!planner.moves_free())
+        idle();
+      else if (!buffer_next())
+        abort();
+    }
+  }
+
+#endif // STREAMING_SEGMENTS
+
 #if HAS_DUPLICATION_MODE
   bool extruder_duplication_enabled;
   #if ENABLED(MULTI_NOZZLE_DUPLICATION)
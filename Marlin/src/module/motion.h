@@ -327,6 +327,44 @@ void line_to_current_position(const_feedRate_t fr_mm_s=feedrate_mm_s);
 
 void prepare_line_to_destination();
 
+#if ENABLED(STREAMING_SEGMENTS)
+  /**
+   * A segmented move still being buffered. idle() adds a few segments at a time,
+   * so G-code processing can go on while a long move is queued. Anything else
+   * that adds to the planner or changes its position finishes the stream first.
+   */
+  class SegmentStream {
+    public:
+      static void start(const xyze_pos_t &target, const uint16_t segments, const_feedRate_t fr_mm_s, const_float_t segment_mm);
+      static bool active() { return index < segments; }
+      static void advance();
+      static void finish();
+      static void abort() { index = segments; }
+
+    private:
+      static xyze_pos_t start_pos, target;
+      static xyze_float_t segment_distance;
+      static uint16_t segments, index;
+      static feedRate_t fr_mm_s;
+      static float segment_mm;
+      static uint8_t extruder;
+      static bool buffering;
+      #ifdef KINEMATIC_SEGMENT_TOLERANCE
+        static abce_pos_t joints;
+        static uint16_t span;
+      #endif
+
+      // Planner inputs (laser power, fans, flow) as they were when the move started
+      struct block_state_t;
+      static block_state_t state;
+      static void swap_state();
+
+      static bool buffer_next();
+  };
+
+  extern SegmentStream segment_stream;
+#endif
+
 void _internal_move_to_destination(const_feedRate_t fr_mm_s=0.0f OPTARG(IS_KINEMATIC, const bool is_fast=false));
 
 inline void prepare_internal_move_to_destination(const_feedRate_t fr_mm_s=0.0f) {
@@ -336,6 +374,10 @@ inline void prepare_internal_move_to_destination(const_feedRate_t fr_mm_s=0.0f)
 #if IS_KINEMATIC
   void prepare_fast_move_to_destination(const_feedRate_t scaled_fr_mm_s=MMS_SCALED(feedrate_mm_s));
 
+  #ifdef KINEMATIC_SEGMENT_TOLERANCE
+    uint16_t kinematic_segment_span(const xyz_pos_t &start, const xyz_float_t &segment_distance, const uint16_t i, const uint16_t segments, const uint16_t prev_span, abce_pos_t &joints);
+  #endif
+
   inline void prepare_internal_fast_move_to_destination(const_feedRate_t fr_mm_s=0.0f) {
     _internal_move_to_destination(fr_mm_s, true);
   }
@@ -110,6 +110,10 @@
   #include "../feature/spindle_laser.h"
 #endif
 
+#if ENABLED(PATH_BLENDING)
+  #include "../feature/path_blend.h"
+#endif
+
 // Delay for delivery of first block to the stepper ISR, if the queue contains 2 or
 // fewer movements. The delay is measured in milliseconds, and must be less than 250ms
 #define BLOCK_DELAY_FOR_1ST_MOVE 100
@@ -1677,6 +1681,10 @@ void Planner::quick_stop() {
 
   const bool was_enabled = stepper.suspend();
 
+  // Drop the rest of a streamed or blended move
+  TERN_(STREAMING_SEGMENTS, segment_stream.abort());
+  TERN_(PATH_BLENDING, path_blend.discard());
+
   // Drop all queue entries
   block_buffer_nonbusy = block_buffer_planned = block_buffer_head = block_buffer_tail;
 
@@ -1726,12 +1734,16 @@ float Planner::triggered_position_mm(const AxisEnum axis) {
 
 bool Planner::busy() {
   return (has_blocks_queued() || cleaning_buffer_counter
+      || TERN0(STREAMING_SEGMENTS, segment_stream.active())
+      || TERN0(PATH_BLENDING, path_blend.pending())
       || TERN0(EXTERNAL_CLOSED_LOOP_CONTROLLER, CLOSED_LOOP_WAITING())
       || TERN0(HAS_SHAPING, stepper.input_shaping_busy())
   );
 }
 
 void Planner::finish_and_disable() {
+  TERN_(PATH_BLENDING, path_blend.flush());
+  TERN_(STREAMING_SEGMENTS, segment_stream.finish());
   while (has_blocks_queued() || cleaning_buffer_counter) idle();
   stepper.disable_all_steppers();
 }
@@ -1792,7 +1804,11 @@ float Planner::get_axis_position_mm(const AxisEnum axis) {
 /**
  * Block until the planner is finished processing
  */
-void Planner::synchronize() { while (busy()) idle(); }
+void Planner::synchronize() {
+  TERN_(PATH_BLENDING, path_blend.flush());
+  TERN_(STREAMING_SEGMENTS, segment_stream.finish());
+  while (busy()) idle();
+}
 
 /**
  * @brief Add a new linear movement to the planner queue (in terms of steps).
@@ -2023,6 +2039,7 @@ bool Planner::_populate_block(
    * only set by apply_power().
    */
   #if HAS_CUTTER
+    TERN_(LASER_RASTER, block->laser.raster_pixels = 0);
     switch (cutter.cutter_mode) {
       default: break;
 
@@ -2037,6 +2054,10 @@ bool Planner::_populate_block(
         case CUTTER_MODE_CONTINUOUS:
           block->laser.power = laser_inline.power;
           block->laser.status = laser_inline.status;
+          #if ENABLED(LASER_RASTER)
+            block->laser.raster_pixels = hints.raster_pixels;
+            if (hints.raster_pixels) memcpy(block->laser.raster_power, hints.raster_power, hints.raster_pixels);
+          #endif
           break;
 
         case CUTTER_MODE_DYNAMIC:
@@ -2243,6 +2264,41 @@ bool Planner::_populate_block(
   // Bail if this is a zero-length block
   if (block->step_event_count < MIN_STEPS_PER_SEGMENT) return false;
 
+  #if ENABLED(ARC_NATIVE_BLOCKS)
+    /**
+     * An arc block is traced by the stepper from its start angle around the center.
+     * Its step events divide the arc finely enough that no motor steps more than once
+     * per event. Get the start and end tangents (scaled to the XY length, in motor
+     * space) to use in place of the chord for junction and jerk handling.
+     */
+    xy_float_t arc_entry_mm{0}, arc_exit_mm{0};
+    float arc_radius = 0;
+    if (hints.arc_angle) {
+      const xy_float_t spm = { settings.axis_steps_per_mm[X_AXIS], settings.axis_steps_per_mm[Y_AXIS] },
+                       rel = { position.a * mm_per_step[X_AXIS] - hints.arc_center.x,
+                               position.b * mm_per_step[Y_AXIS] - hints.arc_center.y };
+      arc_radius = HYPOT(rel.x, rel.y);
+      const float start_angle = ATAN2(rel.y, rel.x),
+                  end_angle = start_angle + hints.arc_angle,
+                  arc_mm = arc_radius * ABS(hints.arc_angle),
+                  tlen = hints.arc_angle < 0 ? -arc_mm : arc_mm;
+
+      block->flag.apply(BLOCK_BIT_ARC);
+      block->arc.center.set(-rel.x * spm.x, -rel.y * spm.y);
+      block->arc.radius.set(arc_radius * spm.x, arc_radius * spm.y);
+      block->arc.start_angle = start_angle;
+      block->arc.angle = hints.arc_angle;
+
+      const uint32_t arc_events = CEIL(arc_mm * TERN(CORE_IS_XY, SQRT(sq(spm.x) + sq(spm.y)), _MAX(spm.x, spm.y)));
+      NOLESS(block->step_event_count, arc_events);
+
+      const float ti = -sin(start_angle) * tlen, tj = cos(start_angle) * tlen,
+                  ui = -sin(end_angle) * tlen,   uj = cos(end_angle) * tlen;
+      arc_entry_mm.set(ARC_MOTOR_A(ti, tj), ARC_MOTOR_B(ti, tj));
+      arc_exit_mm.set(ARC_MOTOR_A(ui, uj), ARC_MOTOR_B(ui, uj));
+    }
+  #endif
+
   TERN_(MIXING_EXTRUDER, mixer.populate_block(block->b_color));
 
   #if HAS_FAN
@@ -2419,6 +2475,17 @@ bool Planner::_populate_block(
     if (cs > max_fr) NOMORE(speed_factor, max_fr / cs);
   }
 
+  #if ENABLED(ARC_NATIVE_BLOCKS)
+    if (block->is_arc()) {
+      // Along an arc each motor may reach the full motor-space speed
+      const float peak = HYPOT(arc_entry_mm.x, arc_entry_mm.y) * inverse_secs;
+      LOOP_L_N(i, 2) if (peak > settings.max_feedrate_mm_s[i]) NOMORE(speed_factor, settings.max_feedrate_mm_s[i] / peak);
+      // Start moving along the entry tangent
+      current_speed.a = arc_entry_mm.x * inverse_secs;
+      current_speed.b = arc_entry_mm.y * inverse_secs;
+    }
+  #endif
+
   // Limit speed on extruders, if any
   #if HAS_EXTRUDERS
     {
@@ -2582,7 +2649,34 @@ bool Planner::_populate_block(
         LIMIT_ACCEL_FLOAT(U_AXIS, 0), LIMIT_ACCEL_FLOAT(V_AXIS, 0), LIMIT_ACCEL_FLOAT(W_AXIS, 0)
       );
     }
+
+    #if ENABLED(ARC_NATIVE_BLOCKS)
+      // The chord steps don't reflect motor usage on an arc. Use the weaker of the XY motors.
+      if (block->is_arc()) {
+        const float arc_accel = _MIN(settings.max_acceleration_mm_per_s2[A_AXIS], settings.max_acceleration_mm_per_s2[B_AXIS])
+                              * TERN(CORE_IS_XY, float(M_SQRT1_2), 1.0f) * steps_per_mm;
+        NOMORE(accel, uint32_t(arc_accel));
+      }
+    #endif
   }
+
+  #if ENABLED(ARC_NATIVE_BLOCKS)
+    // Tangential and centripetal acceleration add up as sqrt(a_t^2 + (v^2/r)^2).
+    // Give the centripetal part up to a/sqrt(2), slowing down to fit, and the rest to a_t.
+    if (block->is_arc()) {
+      const float arc_accel = accel / steps_per_mm,
+                  max_speed_sqr = arc_accel * float(M_SQRT1_2) * arc_radius;
+      if (sq(block->nominal_speed) > max_speed_sqr) {
+        const float arc_factor = SQRT(max_speed_sqr) / block->nominal_speed;
+        current_speed *= arc_factor;
+        block->nominal_rate *= arc_factor;
+        block->nominal_speed *= arc_factor;
+      }
+      const float centripetal = sq(block->nominal_speed) / arc_radius;
+      accel = uint32_t(SQRT(_MAX(sq(arc_accel) - sq(centripetal), 0.5f * sq(arc_accel))) * steps_per_mm);
+    }
+  #endif
+
   block->acceleration_steps_per_s2 = accel;
   block->acceleration = accel / steps_per_mm;
   #if DISABLED(S_CURVE_ACCELERATION)
@@ -2665,7 +2759,18 @@ bool Planner::_populate_block(
      * => normalize the complete junction vector.
      * Elsewise, when needed JD will factor-in the E component
      */
-    if (ANY(IS_CORE, MARKFORGED_XY, MARKFORGED_YX) || esteps > 0)
+    #if ENABLED(ARC_NATIVE_BLOCKS)
+      // An arc enters along its start tangent and leaves along its end tangent
+      xyze_float_t arc_exit_vec;
+      if (block->is_arc()) {
+        unit_vec.a = arc_entry_mm.x; unit_vec.b = arc_entry_mm.y;
+        arc_exit_vec = unit_vec;
+        arc_exit_vec.a = arc_exit_mm.x; arc_exit_vec.b = arc_exit_mm.y;
+        normalize_junction_vector(arc_exit_vec);
+      }
+    #endif
+
+    if (ANY(IS_CORE, MARKFORGED_XY, MARKFORGED_YX, ARC_NATIVE_BLOCKS) || esteps > 0)
       normalize_junction_vector(unit_vec);  // Normalize with XYZE components
     else
       unit_vec *= inverse_millimeters;      // Use pre-calculated (1 / SQRT(x^2 + y^2 + z^2))
@@ -2806,6 +2911,7 @@ bool Planner::_populate_block(
       vmax_junction_sqr = 0;
 
     prev_unit_vec = unit_vec;
+    TERN_(ARC_NATIVE_BLOCKS, if (block->is_arc()) prev_unit_vec = arc_exit_vec);
 
   #endif
 
@@ -2927,6 +3033,14 @@ bool Planner::_populate_block(
 
   // Update previous path unit_vector and nominal speed
   previous_speed = current_speed;
+  #if ENABLED(ARC_NATIVE_BLOCKS)
+    // Leave an arc along its end tangent
+    if (block->is_arc()) {
+      const float exit_factor = block->nominal_speed / block->millimeters;
+      previous_speed.a = arc_exit_mm.x * exit_factor;
+      previous_speed.b = arc_exit_mm.y * exit_factor;
+    }
+  #endif
   previous_nominal_speed = block->nominal_speed;
 
   position = target;  // Update the position
@@ -2951,6 +3065,10 @@ bool Planner::_populate_block(
  */
 void Planner::buffer_sync_block(const BlockFlagBit sync_flag/*=BLOCK_BIT_SYNC_POSITION*/) {
 
+  // Sync after a streamed or blended move
+  TERN_(PATH_BLENDING, path_blend.flush());
+  TERN_(STREAMING_SEGMENTS, segment_stream.finish());
+
   // Wait for the next available block
   uint8_t next_buffer_head;
   block_t * const block = get_next_free_block(next_buffer_head);
@@ -3012,6 +3130,10 @@ bool Planner::buffer_segment(const abce_pos_t &abce
   // If we are cleaning, do not accept queuing of movements
   if (cleaning_buffer_counter) return false;
 
+  // Queue a streamed or blended move ahead of this one
+  TERN_(PATH_BLENDING, path_blend.flush());
+  TERN_(STREAMING_SEGMENTS, segment_stream.finish());
+
   // When changing extruders recalculate steps corresponding to the E position
   #if ENABLED(DISTINCT_E_FACTORS)
     if (last_extruder != extruder && settings.axis_steps_per_mm[E_AXIS_N(extruder)] != settings.axis_steps_per_mm[E_AXIS_N(last_extruder)]) {
@@ -3133,10 +3255,64 @@ bool Planner::buffer_line(const xyze_pos_t &cart, const_feedRate_t fr_mm_s
   , const uint8_t extruder/*=active_extruder*/
   , const PlannerHints &hints/*=PlannerHints()*/
 ) {
+  TERN_(PATH_BLENDING, path_blend.flush());
+  TERN_(STREAMING_SEGMENTS, segment_stream.finish()); // Before the kinematic line uses position_cart
+
   xyze_pos_t machine = cart;
   TERN_(HAS_POSITION_MODIFIERS, apply_modifiers(machine));
 
   #if IS_KINEMATIC
+    // Cartesian XYZ to kinematic ABC, stored in global 'delta'
+    inverse_kinematics(machine);
+    return buffer_kinematic_line(cart, machine, fr_mm_s, extruder, hints);
+  #else
+    return buffer_segment(machine, fr_mm_s, extruder, hints);
+  #endif
+} // buffer_line()
+
+#ifdef DELTA_IK_BATCH
+
+  /**
+   * Add up to DELTA_IK_BATCH lines to the buffer, doing the
+   * inverse kinematics for all of them in a single pass.
+   *
+   * Return the number of lines that were buffered.
+   */
+  uint8_t Planner::buffer_lines(const xyze_pos_t cart[], const uint8_t count, const_feedRate_t fr_mm_s
+    , const uint8_t extruder/*=active_extruder*/
+    , const PlannerHints &hints/*=PlannerHints()*/
+  ) {
+    TERN_(PATH_BLENDING, path_blend.flush());
+    TERN_(STREAMING_SEGMENTS, segment_stream.finish());
+
+    xyze_pos_t machine[DELTA_IK_BATCH];
+    float x[DELTA_IK_BATCH], y[DELTA_IK_BATCH], z[DELTA_IK_BATCH],
+          a[DELTA_IK_BATCH], b[DELTA_IK_BATCH], c[DELTA_IK_BATCH];
+
+    LOOP_L_N(i, count) {
+      machine[i] = cart[i];
+      TERN_(HAS_POSITION_MODIFIERS, apply_modifiers(machine[i]));
+      x[i] = machine[i].x; y[i] = machine[i].y; z[i] = machine[i].z;
+    }
+
+    inverse_kinematics_batch(count, x, y, z, a, b, c);
+
+    LOOP_L_N(i, count) {
+      delta.set(a[i], b[i], c[i]);
+      if (!buffer_kinematic_line(cart[i], machine[i], fr_mm_s, extruder, hints)) return i;
+    }
+    return count;
+  }
+
+#endif // DELTA_IK_BATCH
+
+#if IS_KINEMATIC
+
+  /**
+   * Buffer a kinematic move, with global 'delta' already
+   * holding the joint position for the 'machine' position.
+   */
+  bool Planner::buffer_kinematic_line(const xyze_pos_t &cart, const xyze_pos_t &machine, const_feedRate_t fr_mm_s, const uint8_t extruder, const PlannerHints &hints) {
 
     #if HAS_JUNCTION_DEVIATION
       const xyze_pos_t cart_dist_mm = LOGICAL_AXIS_ARRAY(
@@ -3153,9 +3329,6 @@ bool Planner::buffer_line(const xyze_pos_t &cart, const_feedRate_t fr_mm_s
       );
     #endif
 
-    // Cartesian XYZ to kinematic ABC, stored in global 'delta'
-    inverse_kinematics(machine);
-
     PlannerHints ph = hints;
     if (!hints.millimeters)
       ph.millimeters = (cart_dist_mm.x || cart_dist_mm.y)
@@ -3177,14 +3350,15 @@ bool Planner::buffer_line(const xyze_pos_t &cart, const_feedRate_t fr_mm_s
       return true;
     }
     return false;
-  #else
-    return buffer_segment(machine, fr_mm_s, extruder, hints);
-  #endif
-} // buffer_line()
+  }
+
+#endif // IS_KINEMATIC
 
 #if ENABLED(DIRECT_STEPPING)
 
   void Planner::buffer_page(const page_idx_t page_idx, const uint8_t extruder, const uint16_t num_steps) {
+    TERN_(PATH_BLENDING, path_blend.flush());
+    TERN_(STREAMING_SEGMENTS, segment_stream.finish());
     if (!last_page_step_rate) {
       kill(GET_TEXT_F(MSG_BAD_PAGE_SPEED));
       return;
@@ -3248,6 +3422,8 @@ bool Planner::buffer_line(const xyze_pos_t &cart, const_feedRate_t fr_mm_s
  * The provided ABCE position is in machine units.
  */
 void Planner::set_machine_position_mm(const abce_pos_t &abce) {
+  TERN_(PATH_BLENDING, path_blend.flush());
+  TERN_(STREAMING_SEGMENTS, segment_stream.finish());
   TERN_(DISTINCT_E_FACTORS, last_extruder = active_extruder);
   TERN_(HAS_POSITION_FLOAT, position_float = abce);
   position.set(
@@ -3282,6 +3458,9 @@ void Planner::set_machine_position_mm(const abce_pos_t &abce) {
 }
 
 void Planner::set_position_mm(const xyze_pos_t &xyze) {
+  // Held and streamed moves go through 'delta' and 'position_cart', so buffer them first
+  TERN_(PATH_BLENDING, path_blend.flush());
+  TERN_(STREAMING_SEGMENTS, segment_stream.finish());
   xyze_pos_t machine = xyze;
   TERN_(HAS_POSITION_MODIFIERS, apply_modifiers(machine, true));
   #if IS_KINEMATIC
@@ -3300,6 +3479,8 @@ void Planner::set_position_mm(const xyze_pos_t &xyze) {
    * Setters for planner position (also setting stepper position).
    */
   void Planner::set_e_position_mm(const_float_t e) {
+    TERN_(PATH_BLENDING, path_blend.flush());
+    TERN_(STREAMING_SEGMENTS, segment_stream.finish());
     const uint8_t axis_index = E_AXIS_N(active_extruder);
     TERN_(DISTINCT_E_FACTORS, last_extruder = active_extruder);
 
@@ -116,6 +116,9 @@ enum BlockFlagBit {
 
   // Sync laser power from a queued block
   OPTARG(LASER_POWER_SYNC, BLOCK_BIT_LASER_PWR)
+
+  // Arc traced by the stepper
+  OPTARG(ARC_NATIVE_BLOCKS, BLOCK_BIT_ARC)
 };
 
 /**
@@ -145,6 +148,10 @@ typedef struct {
       #if ENABLED(LASER_POWER_SYNC)
         bool sync_laser_pwr:1;
       #endif
+
+      #if ENABLED(ARC_NATIVE_BLOCKS)
+        bool arc:1;
+      #endif
     };
   };
 
@@ -175,6 +182,11 @@ typedef struct {
       float trap_ramp_entry_incr;                     // Acceleration per step laser power increment (trap entry)
       float trap_ramp_exit_decr;                      // Deceleration per step laser power decrement (trap exit)
     #endif
+
+    #if ENABLED(LASER_RASTER)
+      uint8_t raster_pixels;                          // Pixels in a G7 raster run, 0 for a plain move
+      uint8_t raster_power[LASER_RASTER_PIXELS];      // Power OCR of each pixel, spaced evenly along the move
+    #endif
   } block_laser_t;
 
 #endif
@@ -196,6 +208,7 @@ typedef struct PlannerBlock {
   bool is_pwr_sync() { return TERN0(LASER_POWER_SYNC, flag.sync_laser_pwr); }
   bool is_sync() { return flag.sync_position || is_fan_sync() || is_pwr_sync(); }
   bool is_page() { return TERN0(DIRECT_STEPPING, flag.page); }
+  bool is_arc() { return TERN0(ARC_NATIVE_BLOCKS, flag.arc); }
   bool is_move() { return !(is_sync() || is_page()); }
 
   // Fields used by the motion planner to manage acceleration
@@ -254,6 +267,15 @@ typedef struct PlannerBlock {
     page_idx_t page_idx;                    // Page index used for direct stepping
   #endif
 
+  #if ENABLED(ARC_NATIVE_BLOCKS)
+    struct {
+      xy_float_t center,                    // Arc center relative to the start, in X/Y steps
+                 radius;                    // Arc radius in X/Y steps
+      float start_angle,                    // Angle of the start point around the center (radians)
+            angle;                          // Signed angular travel, CCW positive (radians)
+    } arc;
+  #endif
+
   #if HAS_CUTTER
     cutter_power_t cutter_power;            // Power level for Spindle, Laser, etc.
   #endif
@@ -289,6 +311,20 @@ typedef struct PlannerBlock {
 
 #define BLOCK_MOD(n) ((n)&(BLOCK_BUFFER_SIZE-1))
 
+#if ENABLED(ARC_NATIVE_BLOCKS)
+  // Motor A/B travel for a head X/Y travel, and the angular spacing of the
+  // points on a circle where a motor changes direction
+  #if CORE_IS_XY
+    #define ARC_MOTOR_A(X,Y) ((X) + (Y))
+    #define ARC_MOTOR_B(X,Y) CORESIGN((X) - (Y))
+    #define ARC_REVERSAL_ANGLE RADIANS(45)
+  #else
+    #define ARC_MOTOR_A(X,Y) (X)
+    #define ARC_MOTOR_B(X,Y) (Y)
+    #define ARC_REVERSAL_ANGLE RADIANS(90)
+  #endif
+#endif
+
 #if ENABLED(LASER_FEATURE)
   typedef struct {
     /**
@@ -350,7 +386,7 @@ typedef struct {
   typedef IF<(BLOCK_BUFFER_SIZE > 64), uint16_t, uint8_t>::type last_move_t;
 #endif
 
-#if ENABLED(ARC_SUPPORT)
+#if EITHER(ARC_SUPPORT, BEZIER_CURVE_SUPPORT)
   #define HINTS_CURVE_RADIUS
   #define HINTS_SAFE_EXIT_SPEED
 #endif
@@ -371,6 +407,16 @@ struct PlannerHints {
                                       // would calculate if it knew the as-yet-unbuffered path
   #endif
 
+  #if ENABLED(ARC_NATIVE_BLOCKS)
+    xy_pos_t arc_center;              // Center of a native arc move (mm)
+    float arc_angle = 0.0;            // Signed angular travel of a native arc move, 0 for a line
+  #endif
+
+  #if ENABLED(LASER_RASTER)
+    const uint8_t *raster_power = nullptr; // Power OCR of each pixel of a G7 raster run
+    uint8_t raster_pixels = 0;
+  #endif
+
   PlannerHints(const_float_t mm=0.0f) : millimeters(mm) {}
 };
 
@@ -860,6 +906,21 @@ class Planner {
       , const PlannerHints &hints=PlannerHints()
     );
 
+    #ifdef DELTA_IK_BATCH
+      static uint8_t buffer_lines(const xyze_pos_t cart[], const uint8_t count, const_feedRate_t fr_mm_s
+        , const uint8_t extruder=active_extruder
+        , const PlannerHints &hints=PlannerHints()
+      );
+    #endif
+
+  private:
+
+    #if IS_KINEMATIC
+      static bool buffer_kinematic_line(const xyze_pos_t &cart, const xyze_pos_t &machine, const_feedRate_t fr_mm_s, const uint8_t extruder, const PlannerHints &hints);
+    #endif
+
+  public:
+
     #if ENABLED(DIRECT_STEPPING)
       static void buffer_page(const page_idx_t page_idx, const uint8_t extruder, const uint16_t num_steps);
     #endif
@@ -1024,15 +1085,15 @@ class Planner {
 
     static void calculate_trapezoid_for_block(block_t * const block, const_float_t entry_factor, const_float_t exit_factor);
 
-    static void reverse_pass_kernel(block_t * const current, const block_t * const next OPTARG(ARC_SUPPORT, const_float_t safe_exit_speed_sqr));
+    static void reverse_pass_kernel(block_t * const current, const block_t * const next OPTARG(HINTS_SAFE_EXIT_SPEED, const_float_t safe_exit_speed_sqr));
     static void forward_pass_kernel(const block_t * const previous, block_t * const current, uint8_t block_index);
 
-    static void reverse_pass(TERN_(ARC_SUPPORT, const_float_t safe_exit_speed_sqr));
+    static void reverse_pass(TERN_(HINTS_SAFE_EXIT_SPEED, const_float_t safe_exit_speed_sqr));
     static void forward_pass();
 
-    static void recalculate_trapezoids(TERN_(ARC_SUPPORT, const_float_t safe_exit_speed_sqr));
+    static void recalculate_trapezoids(TERN_(HINTS_SAFE_EXIT_SPEED, const_float_t safe_exit_speed_sqr));
 
-    static void recalculate(TERN_(ARC_SUPPORT, const_float_t safe_exit_speed_sqr));
+    static void recalculate(TERN_(HINTS_SAFE_EXIT_SPEED, const_float_t safe_exit_speed_sqr));
 
     #if HAS_JUNCTION_DEVIATION
 
@@ -60,6 +60,30 @@ static inline float eval_bezier(const_float_t a, const_float_t b, const_float_t
   return interp(iabc, ibcd, t);
 }
 
+/**
+ * The first and second derivatives of a cubic Bézier curve with respect to t.
+ */
+static inline float eval_bezier_d1(const_float_t a, const_float_t b, const_float_t c, const_float_t d, const_float_t t) {
+  return 3 * interp(interp(b - a, c - b, t), interp(c - b, d - c, t), t);
+}
+static inline float eval_bezier_d2(const_float_t a, const_float_t b, const_float_t c, const_float_t d, const_float_t t) {
+  return 6 * interp(c - 2 * b + a, d - 2 * c + b, t);
+}
+
+/**
+ * Radius of curvature of the XY curve at t, or 0 where it is (nearly) straight.
+ * The planner treats a zero radius as "no hint" and falls back to the junction
+ * deviation of the chords.
+ */
+static float bezier_radius(const xy_pos_t &p0, const xy_pos_t &p1, const xy_pos_t &p2, const xy_pos_t &p3, const_float_t t) {
+  const float dx = eval_bezier_d1(p0.x, p1.x, p2.x, p3.x, t), dy = eval_bezier_d1(p0.y, p1.y, p2.y, p3.y, t),
+              ddx = eval_bezier_d2(p0.x, p1.x, p2.x, p3.x, t), ddy = eval_bezier_d2(p0.y, p1.y, p2.y, p3.y, t),
+              cross = ABS(dx * ddy - dy * ddx),
+              speed_sqr = sq(dx) + sq(dy),
+              speed_cubed = speed_sqr * SQRT(speed_sqr);
+  return cross > speed_cubed * 0.0001f ? speed_cubed / cross : 0.0f; // Radii over 10m count as straight
+}
+
 /**
  * We approximate Euclidean distance with the sum of the coordinates
  * offset (so-called "norm 1"), which is quicker to compute.
@@ -104,6 +128,11 @@ static inline float dist1(const_float_t x1, const_float_t y1, const_float_t x2,
  * estimates; however, given the improbability of such configurations,
  * the mitigation offered by MIN_STEP and the small computational
  * power available on Arduino, I think it is not wise to implement it.
+ *
+ * The pieces are planned as one curve: each junction gets the radius of
+ * curvature there, each piece is slowed so its centripetal acceleration
+ * stays within the XY acceleration limits, and the planner is told the
+ * exit speed from which the rest of the curve can still stop.
  */
 void cubic_b_spline(
   const xyze_pos_t &position,       // current position
@@ -124,6 +153,11 @@ void cubic_b_spline(
   // Hints to help optimize the move
   PlannerHints hints;
 
+  // Limit the speed on the curve by centripetal acceleration, like arcs
+  const float limiting_accel = _MIN(planner.settings.max_acceleration_mm_per_s2[X_AXIS], planner.settings.max_acceleration_mm_per_s2[Y_AXIS]);
+  const xy_pos_t start = position, end = target;
+  float radius = bezier_radius(start, first, second, end, 0);
+
   for (float t = 0; t < 1;) {
 
     thermalManager.task();
@@ -180,7 +214,11 @@ void cubic_b_spline(
       }
     */
 
-    hints.millimeters = new_t - t;
+    // The junction at the start of this piece has the curvature found at the end of the last one
+    const float start_radius = radius;
+    radius = bezier_radius(start, first, second, end, new_t);
+    hints.curve_radius = t > 0 ? start_radius : 0.0f;
+
     t = new_t;
 
     // Compute and send new position
@@ -206,7 +244,15 @@ void cubic_b_spline(
       const xyze_pos_t &pos = bez_target;
     #endif
 
-    if (!planner.buffer_line(pos, scaled_fr_mm_s, active_extruder, hints))
+    // Slow down for the tightest curvature at either end of the piece
+    feedRate_t fr_mm_s = scaled_fr_mm_s;
+    const float min_radius = start_radius && radius ? _MIN(start_radius, radius) : _MAX(start_radius, radius);
+    if (min_radius) NOMORE(fr_mm_s, SQRT(limiting_accel * min_radius));
+
+    // Leave at a speed that can still stop before the end (the straight line there is the shortest path)
+    hints.safe_exit_speed_sqr = t < 1 ? _MIN(sq(fr_mm_s), 2 * limiting_accel * HYPOT(end.x - bez_target.x, end.y - bez_target.y)) : 0.0f;
+
+    if (!planner.buffer_line(pos, fr_mm_s, active_extruder, hints))
       break;
   }
 }
@@ -48,6 +48,10 @@
   #include "../feature/bedlevel/bdl/bdl.h"
 #endif
 
+#if EITHER(FAST_MESH_SCAN, ENDSTOP_EDGE_CAPTURE)
+  #include "planner.h"
+#endif
+
 #if ENABLED(DELTA)
   #include "delta.h"
 #endif
@@ -57,6 +61,10 @@
   float largest_sensorless_adj = 0;
 #endif
 
+#if ENABLED(ENDSTOP_EDGE_CAPTURE)
+  float trigger_overrun = 0;  // Z travel between the probe edge and the stop (mm)
+#endif
+
 #if EITHER(HAS_QUIET_PROBING, USE_SENSORLESS)
   #include "stepper/indirection.h"
   #if BOTH(HAS_QUIET_PROBING, PROBING_ESTEPPERS_OFF)
@@ -641,6 +649,9 @@ bool Probe::probe_down_to_z(const_float_t z, const_feedRate_t fr_mm_s) {
   // Get Z where the steppers were interrupted
   set_current_from_steppers_for_axis(Z_AXIS);
 
+  // Distance the steppers ran past the latched probe edge
+  TERN_(ENDSTOP_EDGE_CAPTURE, trigger_overrun = probe_triggered ? planner.get_axis_position_mm(Z_AXIS) - planner.triggered_position_mm(Z_AXIS) : 0);
+
   // Tell the planner where we actually are
   sync_plan_position();
 
@@ -730,7 +741,7 @@ float Probe::run_z_probe(const bool sanity_check/*=true*/) {
     if (try_to_probe(PSTR("FAST"), z_probe_low_point, z_probe_fast_mm_s,
                      sanity_check, Z_CLEARANCE_BETWEEN_PROBES) ) return NAN;
 
-    const float first_probe_z = DIFF_TERN(HAS_DELTA_SENSORLESS_PROBING, current_position.z, largest_sensorless_adj);
+    const float first_probe_z = DIFF_TERN(HAS_DELTA_SENSORLESS_PROBING, current_position.z, largest_sensorless_adj) TERN_(ENDSTOP_EDGE_CAPTURE, - trigger_overrun);
     if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("1st Probe Z:", first_probe_z);
 
     // Raise to give the probe clearance
@@ -772,7 +783,7 @@ float Probe::run_z_probe(const bool sanity_check/*=true*/) {
 
       TERN_(MEASURE_BACKLASH_WHEN_PROBING, backlash.measure_with_probe());
 
-      const float z = DIFF_TERN(HAS_DELTA_SENSORLESS_PROBING, current_position.z, largest_sensorless_adj);
+      const float z = DIFF_TERN(HAS_DELTA_SENSORLESS_PROBING, current_position.z, largest_sensorless_adj) TERN_(ENDSTOP_EDGE_CAPTURE, - trigger_overrun);
 
       #if EXTRA_PROBING > 0
         // Insert Z measurement into probes[]. Keep it sorted ascending.
@@ -914,6 +925,63 @@ float Probe::probe_at_point(const_float_t rx, const_float_t ry, const ProbePtRai
   return measured_z;
 }
 
+#if ENABLED(FAST_MESH_SCAN)
+
+  /**
+   * Sweep the probe from start to end (probe-relative) in a single move,
+   * reading the distance sensor on the fly. Fill z[] with the bed height at
+   * 'count' evenly spaced points, start and end included, interpolated
+   * between the two samples that straddle each point.
+   * Return true on failure.
+   */
+  bool Probe::scan_line(const xy_pos_t &start, const xy_pos_t &end, const uint8_t count, float z[]) {
+    const xy_pos_t nstart = start - offset_xy, nend = end - offset_xy;
+    if (count < 2 || !position_is_reachable(nstart) || !position_is_reachable(nend)) return true;
+
+    do_blocking_move_to_xy(nstart, XY_PROBE_FEEDRATE_MM_S);
+
+    const xy_pos_t dir = nend - nstart;
+    const float length = dir.magnitude(), spacing = length / (count - 1);
+
+    // Distance of the nozzle along the line, from the stepper position
+    auto head_distance = [&]{
+      const xy_pos_t pos = { planner.get_axis_position_mm(X_AXIS), planner.get_axis_position_mm(Y_AXIS) },
+                     rel = pos - nstart;
+      return (rel.x * dir.x + rel.y * dir.y) / length;
+    };
+
+    float last_d = 0, last_z = current_position.z - bdl.read();
+    if (isnan(last_z)) return true;
+    z[0] = last_z;
+    uint8_t next = 1;
+
+    current_position.set(nend.x, nend.y);
+    line_to_current_position(XY_PROBE_FEEDRATE_MM_S);
+
+    for (;;) {
+      const bool moving = planner.busy();
+      // Take the sample at the midpoint of the sensor read
+      const float d1 = head_distance(), zs = current_position.z - bdl.read(), d = (d1 + head_distance()) * 0.5f;
+      if (!isnan(zs)) {
+        // Fill every point passed since the previous sample
+        for (; next < count && (next * spacing <= d || !moving); ++next) {
+          const float t = d > last_d ? (next * spacing - last_d) / (d - last_d) : 1.0f;
+          z[next] = last_z + (zs - last_z) * _MIN(t, 1.0f);
+        }
+        last_d = d;
+        last_z = zs;
+      }
+      if (!moving) break;
+      idle_no_sleep();
+    }
+
+    if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("Scanned ", next, "/", count, " points to X", nend.x, " Y", nend.y);
+
+    return next < count;
+  }
+
+#endif // FAST_MESH_SCAN
+
 #if HAS_Z_SERVO_PROBE
 
   void Probe::servo_probe_init() {
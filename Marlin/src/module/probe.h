@@ -144,6 +144,10 @@ public:
       return probe_at_point(pos.x, pos.y, raise_after, verbose_level, probe_relative, sanity_check);
     }
 
+    #if ENABLED(FAST_MESH_SCAN)
+      static bool scan_line(const xy_pos_t &start, const xy_pos_t &end, const uint8_t count, float z[]);
+    #endif
+
   #else
 
     static constexpr xyz_pos_t offset = xyz_pos_t(NUM_AXIS_ARRAY_1(0)); // See #16767
@@ -250,8 +250,10 @@ typedef struct SettingsDataStruct {
   //
   float mbl_z_offset;                                   // bedlevel.z_offset
   uint8_t mesh_num_x, mesh_num_y;                       // GRID_MAX_POINTS_X, GRID_MAX_POINTS_Y
-  float mbl_z_values[TERN(MESH_BED_LEVELING, GRID_MAX_POINTS_X, 3)]   // bedlevel.z_values
-                    [TERN(MESH_BED_LEVELING, GRID_MAX_POINTS_Y, 3)];
+  #if !BOTH(MESH_BED_LEVELING, EEPROM_LAZY_LOAD)
+    float mbl_z_values[TERN(MESH_BED_LEVELING, GRID_MAX_POINTS_X, 3)]   // bedlevel.z_values
+                      [TERN(MESH_BED_LEVELING, GRID_MAX_POINTS_Y, 3)];
+  #endif
 
   //
   // HAS_BED_PROBE
@@ -270,7 +272,9 @@ typedef struct SettingsDataStruct {
   uint8_t grid_max_x, grid_max_y;                       // GRID_MAX_POINTS_X, GRID_MAX_POINTS_Y
   xy_pos_t bilinear_grid_spacing, bilinear_start;       // G29 L F
   #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
-    bed_mesh_t z_values;                                // G29
+    #if DISABLED(EEPROM_LAZY_LOAD)
+      bed_mesh_t z_values;                              // G29
+    #endif
   #else
     float z_values[3][3];
   #endif
@@ -757,6 +761,9 @@ void MarlinSettings::postprocess() {
    * M500 - Store Configuration
    */
   bool MarlinSettings::save() {
+    // Don't overwrite a mesh that was never read back
+    TERN_(EEPROM_LAZY_LOAD, load_deferred());
+
     float dummyf = 0;
     char ver[4] = "ERR";
 
@@ -875,7 +882,9 @@ void MarlinSettings::postprocess() {
       EEPROM_WRITE(mesh_num_x);
       EEPROM_WRITE(mesh_num_y);
 
-      #if ENABLED(MESH_BED_LEVELING)
+      #if BOTH(MESH_BED_LEVELING, EEPROM_LAZY_LOAD)
+        // Written to the mesh section below
+      #elif ENABLED(MESH_BED_LEVELING)
         EEPROM_WRITE(bedlevel.z_values);
       #else
         for (uint8_t q = mesh_num_x * mesh_num_y; q--;) EEPROM_WRITE(dummyf);
@@ -931,7 +940,9 @@ void MarlinSettings::postprocess() {
         EEPROM_WRITE(bilinear_start);
       #endif
 
-      #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
+      #if BOTH(AUTO_BED_LEVELING_BILINEAR, EEPROM_LAZY_LOAD)
+        // Written to the mesh section below
+      #elif ENABLED(AUTO_BED_LEVELING_BILINEAR)
         EEPROM_WRITE(bedlevel.z_values);              // 9-256 floats
       #else
         dummyf = 0;
@@ -1648,6 +1659,8 @@ void MarlinSettings::postprocess() {
       DEBUG_ECHO_MSG("Settings Stored (", eeprom_size, " bytes; crc ", (uint32_t)final_crc, ")");
 
       eeprom_error |= size_error(eeprom_size);
+
+      TERN_(EEPROM_LAZY_LOAD, eeprom_error |= store_mesh_section());
     }
     EEPROM_FINISH();
 
@@ -1675,6 +1688,9 @@ void MarlinSettings::postprocess() {
   bool MarlinSettings::_load() {
     if (!EEPROM_START(EEPROM_OFFSET)) return false;
 
+    // The old stored mesh is no longer wanted
+    TERN_(EEPROM_LAZY_LOAD, if (!validating) mesh_pending = false);
+
     char stored_ver[4];
     EEPROM_READ_ALWAYS(stored_ver);
 
@@ -1812,7 +1828,11 @@ void MarlinSettings::postprocess() {
         EEPROM_READ_ALWAYS(mesh_num_x);
         EEPROM_READ_ALWAYS(mesh_num_y);
 
-        #if ENABLED(MESH_BED_LEVELING)
+        #if BOTH(MESH_BED_LEVELING, EEPROM_LAZY_LOAD)
+          // The mesh section is checked on its own in load_mesh_section()
+          if (!validating) bedlevel.z_offset = dummyf;
+          UNUSED(mesh_num_x); UNUSED(mesh_num_y);
+        #elif ENABLED(MESH_BED_LEVELING)
           if (!validating) bedlevel.z_offset = dummyf;
           if (mesh_num_x == (GRID_MAX_POINTS_X) && mesh_num_y == (GRID_MAX_POINTS_Y)) {
             // EEPROM data fits the current mesh
@@ -1863,18 +1883,26 @@ void MarlinSettings::postprocess() {
         xy_pos_t spacing, start;
         EEPROM_READ(spacing);                          // 2 ints
         EEPROM_READ(start);                            // 2 ints
-        #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
-          if (grid_max_x == (GRID_MAX_POINTS_X) && grid_max_y == (GRID_MAX_POINTS_Y)) {
-            if (!validating) set_bed_leveling_enabled(false);
+        #if BOTH(AUTO_BED_LEVELING_BILINEAR, EEPROM_LAZY_LOAD)
+          // The mesh section is checked on its own in load_mesh_section()
+          if (!validating && grid_max_x == (GRID_MAX_POINTS_X) && grid_max_y == (GRID_MAX_POINTS_Y)) {
+            set_bed_leveling_enabled(false);
             bedlevel.set_grid(spacing, start);
-            EEPROM_READ(bedlevel.z_values);                 // 9 to 256 floats
-          }
-          else // EEPROM data is stale
-        #endif // AUTO_BED_LEVELING_BILINEAR
-          {
-            // Skip past disabled (or stale) Bilinear Grid data
-            for (uint16_t q = grid_max_x * grid_max_y; q--;) EEPROM_READ(dummyf);
           }
+        #else
+          #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
+            if (grid_max_x == (GRID_MAX_POINTS_X) && grid_max_y == (GRID_MAX_POINTS_Y)) {
+              if (!validating) set_bed_leveling_enabled(false);
+              bedlevel.set_grid(spacing, start);
+              EEPROM_READ(bedlevel.z_values);                 // 9 to 256 floats
+            }
+            else // EEPROM data is stale
+          #endif // AUTO_BED_LEVELING_BILINEAR
+            {
+              // Skip past disabled (or stale) Bilinear Grid data
+              for (uint16_t q = grid_max_x * grid_max_y; q--;) EEPROM_READ(dummyf);
+            }
+        #endif
       }
 
       //
@@ -2642,7 +2670,10 @@ void MarlinSettings::postprocess() {
         TERN_(HOST_EEPROM_CHITCHAT, hostui.notify(F("Stored settings retrieved")));
       }
 
-      if (!validating && !eeprom_error) postprocess();
+      if (!validating && !eeprom_error) {
+        postprocess();
+        TERN_(EEPROM_LAZY_LOAD, mesh_pending = true);
+      }
 
       #if ENABLED(AUTO_BED_LEVELING_UBL)
         if (!validating) {
@@ -2676,13 +2707,13 @@ void MarlinSettings::postprocess() {
       #endif
     }
 
+    EEPROM_FINISH();
+
     #if ENABLED(EEPROM_CHITCHAT) && DISABLED(DISABLE_M503)
       // Report the EEPROM settings
       if (!validating && TERN1(EEPROM_BOOT_SILENT, IsRunning())) report();
     #endif
 
-    EEPROM_FINISH();
-
     return !eeprom_error;
   }
 
@@ -2719,6 +2750,79 @@ void MarlinSettings::postprocess() {
     return false;
   }
 
+  #if ENABLED(EEPROM_LAZY_LOAD)
+
+    /**
+     * The bed mesh is stored in a section of its own just past SettingsData,
+     * with a small header giving its version, grid size, and CRC. Boot only
+     * validates and applies the settings proper (read twice, by validate()
+     * and _load()) and leaves the mesh to be read on first use: enabling
+     * leveling, checking the mesh, G29, M420, M421, M500, M503, or a mesh
+     * editor.
+     */
+    #define MESH_SECTION_VERSION 1
+
+    struct mesh_section_t {
+      uint8_t version, grid_x, grid_y;
+      uint16_t crc;
+    };
+
+    constexpr int mesh_section_index = EEPROM_OFFSET + sizeof(SettingsData);
+
+    bool MarlinSettings::mesh_pending; // = false
+
+    // Call between EEPROM_START and EEPROM_FINISH. Return 'true' on error.
+    bool MarlinSettings::store_mesh_section() {
+      if (mesh_section_index + sizeof(mesh_section_t) + sizeof(bedlevel.z_values) > persistentStore.capacity()) {
+        DEBUG_ERROR_MSG("No EEPROM space for the mesh.");
+        return true;
+      }
+
+      // Data first, then the header that vouches for it
+      int pos = mesh_section_index + sizeof(mesh_section_t);
+      uint16_t crc = 0;
+      if (persistentStore.write_data(pos, (uint8_t*)&bedlevel.z_values, sizeof(bedlevel.z_values), &crc)) return true;
+
+      mesh_section_t head;
+      memset(&head, 0, sizeof(head)); // Padding is stored too, so keep it constant
+      head.version = MESH_SECTION_VERSION;
+      head.grid_x = GRID_MAX_POINTS_X;
+      head.grid_y = GRID_MAX_POINTS_Y;
+      head.crc = crc;
+      pos = mesh_section_index;
+      return persistentStore.write_data(pos, (uint8_t*)&head, sizeof(head), &crc);
+    }
+
+    void MarlinSettings::load_mesh_section() {
+      mesh_pending = false;
+      if (!persistentStore.access_start()) return;
+
+      mesh_section_t head;
+      int pos = mesh_section_index;
+      uint16_t crc = 0;
+      bool bad = persistentStore.read_data(pos, (uint8_t*)&head, sizeof(head), &crc)
+              || head.version != MESH_SECTION_VERSION
+              || head.grid_x != (GRID_MAX_POINTS_X) || head.grid_y != (GRID_MAX_POINTS_Y);
+      if (!bad) {
+        crc = 0;
+        bad = persistentStore.read_data(pos, (uint8_t*)&bedlevel.z_values, sizeof(bedlevel.z_values), &crc)
+           || crc != head.crc;
+      }
+
+      persistentStore.access_finish();
+
+      if (bad) {
+        bedlevel.reset();
+        DEBUG_ECHO_MSG("Stored mesh invalid. Mesh reset.");
+      }
+      else {
+        TERN_(AUTO_BED_LEVELING_BILINEAR, bedlevel.refresh_bed_level());
+        DEBUG_ECHO_MSG("Stored mesh retrieved (", sizeof(bedlevel.z_values), " bytes; crc ", (uint32_t)crc, ")");
+      }
+    }
+
+  #endif // EEPROM_LAZY_LOAD
+
   #if ENABLED(AUTO_BED_LEVELING_UBL)
 
     inline void ubl_invalid_slot(const int s) {
@@ -2737,7 +2841,19 @@ void MarlinSettings::postprocess() {
       return (datasize() + EEPROM_OFFSET + 32) & 0xFFF8;
     }
 
-    #define MESH_STORE_SIZE sizeof(TERN(OPTIMIZED_MESH_STORAGE, mesh_store_t, bedlevel.z_values))
+    #if ENABLED(OPTIMIZED_MESH_STORAGE)
+      // Packed slots start with a marker and CRC so slots in the old
+      // absolute format (or never written) are refused instead of unpacked.
+      #define MESH_SLOT_MAGIC 0x4D50
+
+      struct mesh_slot_head_t {
+        uint16_t magic, crc;
+      };
+
+      #define MESH_STORE_SIZE (sizeof(mesh_slot_head_t) + sizeof(mesh_store_t))
+    #else
+      #define MESH_STORE_SIZE sizeof(bedlevel.z_values)
+    #endif
 
     uint16_t MarlinSettings::calc_num_meshes() {
       return (meshes_end - meshes_start_index()) / MESH_STORE_SIZE;
@@ -2762,18 +2878,25 @@ void MarlinSettings::postprocess() {
         uint16_t crc = 0;
 
         #if ENABLED(OPTIMIZED_MESH_STORAGE)
-          int16_t z_mesh_store[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
-          bedlevel.set_store_from_mesh(bedlevel.z_values, z_mesh_store);
-          uint8_t * const src = (uint8_t*)&z_mesh_store;
+          mesh_store_t z_mesh_store;
+          z_mesh_store.pack(bedlevel.z_values);
+
+          // Data first, then the header that vouches for it
+          persistentStore.access_start();
+          int data_pos = pos + sizeof(mesh_slot_head_t);
+          bool status = persistentStore.write_data(data_pos, (uint8_t*)&z_mesh_store, sizeof(z_mesh_store), &crc);
+          if (!status) {
+            const mesh_slot_head_t head = { MESH_SLOT_MAGIC, crc };
+            status = persistentStore.write_data(pos, (uint8_t*)&head, sizeof(head), &crc);
+          }
+          persistentStore.access_finish();
         #else
-          uint8_t * const src = (uint8_t*)&bedlevel.z_values;
+          // Write crc to MAT along with other data, or just tack on to the beginning or end
+          persistentStore.access_start();
+          const bool status = persistentStore.write_data(pos, (uint8_t*)&bedlevel.z_values, MESH_STORE_SIZE, &crc);
+          persistentStore.access_finish();
         #endif
 
-        // Write crc to MAT along with other data, or just tack on to the beginning or end
-        persistentStore.access_start();
-        const bool status = persistentStore.write_data(pos, src, MESH_STORE_SIZE, &crc);
-        persistentStore.access_finish();
-
         if (status) SERIAL_ECHOLNPGM("?Unable to save mesh data.");
         else        DEBUG_ECHOLNPGM("Mesh saved in slot ", slot);
 
@@ -2798,24 +2921,41 @@ void MarlinSettings::postprocess() {
         int pos = mesh_slot_offset(slot);
         uint16_t crc = 0;
         #if ENABLED(OPTIMIZED_MESH_STORAGE)
-          int16_t z_mesh_store[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
-          uint8_t * const dest = (uint8_t*)&z_mesh_store;
-        #else
-          uint8_t * const dest = into ? (uint8_t*)into : (uint8_t*)&bedlevel.z_values;
-        #endif
-
-        persistentStore.access_start();
-        uint16_t status = persistentStore.read_data(pos, dest, MESH_STORE_SIZE, &crc);
-        persistentStore.access_finish();
+          mesh_slot_head_t head;
+          mesh_store_t z_mesh_store;
+
+          persistentStore.access_start();
+          uint16_t status = persistentStore.read_data(pos, (uint8_t*)&head, sizeof(head), &crc)
+                         || head.magic != MESH_SLOT_MAGIC;
+          if (!status) {
+            crc = 0;
+            status = persistentStore.read_data(pos, (uint8_t*)&z_mesh_store, sizeof(z_mesh_store), &crc)
+                  || crc != head.crc;
+          }
+          persistentStore.access_finish();
 
-        #if ENABLED(OPTIMIZED_MESH_STORAGE)
-          if (into) {
-            float z_values[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
-            bedlevel.set_mesh_from_store(z_mesh_store, z_values);
+          // Never level with a slot that failed the check
+          if (status) {
+            if (into)
+              LOOP_L_N(i, GRID_MAX_POINTS) ((float*)into)[i] = NAN;
+            else {
+              bedlevel.invalidate();
+              bedlevel.storage_slot = -1;
+            }
+          }
+          else if (into) {
+            bed_mesh_t z_values;
+            z_mesh_store.unpack(z_values);
             memcpy(into, z_values, sizeof(z_values));
           }
           else
-            bedlevel.set_mesh_from_store(z_mesh_store, bedlevel.z_values);
+            z_mesh_store.unpack(bedlevel.z_values);
+        #else
+          uint8_t * const dest = into ? (uint8_t*)into : (uint8_t*)&bedlevel.z_values;
+
+          persistentStore.access_start();
+          uint16_t status = persistentStore.read_data(pos, dest, MESH_STORE_SIZE, &crc);
+          persistentStore.access_finish();
         #endif
 
         #if ENABLED(DWIN_LCD_PROUI)
@@ -2858,6 +2998,8 @@ void MarlinSettings::postprocess() {
  * M502 - Reset Configuration
  */
 void MarlinSettings::reset() {
+  TERN_(EEPROM_LAZY_LOAD, mesh_pending = false);
+
   LOOP_DISTINCT_AXES(i) {
     planner.settings.max_acceleration_mm_per_s2[i] = pgm_read_dword(&_DMA[ALIM(i, _DMA)]);
     planner.settings.axis_steps_per_mm[i] = pgm_read_float(&_DASU[ALIM(i, _DASU)]);
@@ -2997,6 +3139,7 @@ void MarlinSettings::reset() {
   // Global Leveling
   //
   TERN_(ENABLE_LEVELING_FADE_HEIGHT, new_z_fade_height = (DEFAULT_LEVELING_FADE_HEIGHT));
+  TERN_(EEPROM_LAZY_LOAD, mesh_pending = false); // Don't read the stored mesh over the reset one
   TERN_(HAS_LEVELING, reset_bed_level());
 
   //
@@ -3426,6 +3569,9 @@ void MarlinSettings::reset() {
    * Unless specifically disabled, M503 is available even without EEPROM
    */
   void MarlinSettings::report(const bool forReplay) {
+    // The stored mesh is part of the report
+    TERN_(EEPROM_LAZY_LOAD, load_deferred());
+
     //
     // Announce current units, in case inches are being displayed
     //
@@ -64,6 +64,11 @@ class MarlinSettings {
         if (!loaded && load()) loaded = true;
       }
 
+      #if ENABLED(EEPROM_LAZY_LOAD)
+        static bool mesh_pending;
+        static void load_deferred() { if (mesh_pending) load_mesh_section(); }
+      #endif
+
       #if ENABLED(AUTO_BED_LEVELING_UBL) // Eventually make these available if any leveling system
                                          // That can store is enabled
         static uint16_t meshes_start_index();
@@ -109,6 +114,11 @@ class MarlinSettings {
       static bool _load();
       static bool size_error(const uint16_t size);
 
+      #if ENABLED(EEPROM_LAZY_LOAD)
+        static bool store_mesh_section();
+        static void load_mesh_section();
+      #endif
+
       static int eeprom_index;
       static uint16_t working_crc;
 
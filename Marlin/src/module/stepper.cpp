@@ -268,6 +268,25 @@ int32_t Stepper::ticks_nominal = -1;
 #endif
 
 xyz_long_t Stepper::endstops_trigsteps;
+#if ENABLED(ENDSTOP_EDGE_CAPTURE)
+  xyze_long_t Stepper::captured_position{0};
+  bool Stepper::capture_valid; // = false
+#endif
+#if ENABLED(ARC_NATIVE_BLOCKS)
+  xy_float_t Stepper::arc_vec, Stepper::arc_rot;
+  uint32_t Stepper::arc_events;
+  xy_long_t Stepper::arc_done;
+  axis_bits_t Stepper::arc_dirs;
+#endif
+#if ENABLED(LASER_RASTER)
+  uint8_t Stepper::raster_index, Stepper::raster_rem;
+  uint32_t Stepper::raster_next, Stepper::raster_pitch;
+  uint16_t Stepper::raster_err;
+#endif
+#if ENABLED(LASER_POWER_VELOCITY)
+  uint32_t Stepper::laser_rate_inv;
+  int16_t Stepper::laser_velocity_last;
+#endif
 xyze_long_t Stepper::count_position{0};
 xyze_int8_t Stepper::count_direction{0};
 
@@ -1611,6 +1630,111 @@ void Stepper::isr() {
   #define ISR_MULTI_STEPS 1
 #endif
 
+#if ENABLED(ARC_NATIVE_BLOCKS)
+
+  /**
+   * Step the X and Y motors along an arc block. The head angle advances by an
+   * equal part of the arc on each step event, with an exact sine / cosine every
+   * 128 events to keep rounding from accumulating. Each motor steps whenever its
+   * rounded position along the arc moves ahead of the steps already taken.
+   * The planner splits arcs where a motor would reverse, so the direction
+   * bits taken at block load hold for the whole block.
+   */
+  void Stepper::arc_pulse_prep(xyze_bool_t &step_needed) {
+    const block_t * const blk = current_block;
+
+    if (!(++arc_events & 0x7F)) {
+      const float a = blk->arc.start_angle + blk->arc.angle * (float(arc_events) / step_event_count);
+      arc_vec.set(cos(a), sin(a));
+    }
+    else
+      arc_vec.set(arc_vec.x * arc_rot.x - arc_vec.y * arc_rot.y, arc_vec.y * arc_rot.x + arc_vec.x * arc_rot.y);
+
+    // Head offset from the start of the arc, in X and Y steps
+    const float hx = blk->arc.center.x + blk->arc.radius.x * arc_vec.x,
+                hy = blk->arc.center.y + blk->arc.radius.y * arc_vec.y;
+
+    // Never fall so far behind that the remaining events can't finish the block
+    const int32_t remaining = int32_t(step_event_count - arc_events);
+
+    #define ARC_PULSE_PREP(AXIS, POS) do{ \
+      const int32_t steps = int32_t(blk->steps[_AXIS(AXIS)]); \
+      int32_t want = LROUND(TEST(arc_dirs, _AXIS(AXIS)) ? -(POS) : (POS)); \
+      NOLESS(want, steps - remaining); \
+      NOMORE(want, steps); \
+      step_needed[_AXIS(AXIS)] = want > arc_done[_AXIS(AXIS)]; \
+      if (step_needed[_AXIS(AXIS)]) ++arc_done[_AXIS(AXIS)]; \
+    }while(0)
+
+    ARC_PULSE_PREP(X, ARC_MOTOR_A(hx, hy));
+    ARC_PULSE_PREP(Y, ARC_MOTOR_B(hx, hy));
+  }
+
+#endif // ARC_NATIVE_BLOCKS
+
+#if ENABLED(LASER_RASTER)
+
+  #define RASTER_POWER(I) (current_block->laser.status.isPowered ? current_block->laser.raster_power[I] : 0)
+
+  /**
+   * Light the first pixel of a G7 raster block. The run is split into pixels
+   * of equal step events, with the remainder spread Bresenham-style so the
+   * last pixel ends with the block.
+   */
+  void Stepper::raster_start() {
+    const uint8_t pixels = current_block->laser.raster_pixels;
+    raster_index = 0;
+    raster_pitch = step_event_count / pixels;
+    raster_rem = step_event_count % pixels;
+    raster_err = raster_rem;
+    raster_next = raster_pitch;
+    IF_DISABLED(LASER_POWER_VELOCITY, cutter.apply_power(RASTER_POWER(0)));
+  }
+
+  /**
+   * Light the pixel under the head. A multi-step ISR may pass more than one.
+   */
+  void Stepper::raster_advance() {
+    const uint8_t pixels = current_block->laser.raster_pixels;
+    if (raster_index >= pixels - 1 || step_events_completed < raster_next) return;
+    do {
+      raster_index++;
+      raster_next += raster_pitch;
+      raster_err += raster_rem;
+      if (raster_err >= pixels) { raster_err -= pixels; raster_next++; }
+    } while (raster_index < pixels - 1 && step_events_completed >= raster_next);
+    IF_DISABLED(LASER_POWER_VELOCITY, cutter.apply_power(RASTER_POWER(raster_index)));
+  }
+
+#endif // LASER_RASTER
+
+#if ENABLED(LASER_POWER_VELOCITY)
+
+  /**
+   * Prepare to scale the power of a new block by its speed. A reciprocal of the
+   * nominal rate (<< 30) lets the ISR get the speed ratio with one multiply.
+   */
+  void Stepper::laser_velocity_start() {
+    laser_rate_inv = current_block->nominal_rate ? _BV32(30) / current_block->nominal_rate : 0;
+    laser_velocity_last = -1;
+  }
+
+  /**
+   * Apply the block (or G7 pixel) power times the step rate over the nominal rate
+   */
+  void Stepper::laser_velocity_power(uint32_t rate) {
+    NOMORE(rate, current_block->nominal_rate);
+    const uint16_t ratio = (rate * laser_rate_inv + _BV32(21)) >> 22; // 0-256 for 0-100% of nominal speed
+    const uint8_t base = TERN_(LASER_RASTER, current_block->laser.raster_pixels ? current_block->laser.raster_power[raster_index] :) current_block->laser.power,
+                  power = (uint16_t(base) * ratio) >> 8;
+    if (power != laser_velocity_last) {
+      laser_velocity_last = power;
+      cutter.apply_power(power);
+    }
+  }
+
+#endif // LASER_POWER_VELOCITY
+
 /**
  * This phase of the ISR should ONLY create the pulses for the steppers.
  * This prevents jitter caused by the interval between the start of the
@@ -1833,12 +1957,19 @@ void Stepper::pulse_phase_isr() {
 
     if (!is_page) {
       // Determine if pulses are needed
-      #if HAS_X_STEP
-        PULSE_PREP(X);
-      #endif
-      #if HAS_Y_STEP
-        PULSE_PREP(Y);
-      #endif
+      #if ENABLED(ARC_NATIVE_BLOCKS)
+        if (current_block->is_arc())
+          arc_pulse_prep(step_needed);  // X and Y motors follow the arc
+        else
+      #endif
+      {
+        #if HAS_X_STEP
+          PULSE_PREP(X);
+        #endif
+        #if HAS_Y_STEP
+          PULSE_PREP(Y);
+        #endif
+      }
       #if HAS_Z_STEP
         PULSE_PREP(Z);
       #endif
@@ -2142,6 +2273,13 @@ uint32_t Stepper::block_phase_isr() {
     else {
       // Step events not completed yet...
 
+      // Light the next pixel of a G7 raster run
+      #if ENABLED(LASER_RASTER)
+        if (current_block->laser.raster_pixels && current_block->laser.status.isEnabled) raster_advance();
+      #endif
+
+      TERN_(LASER_POWER_VELOCITY, uint32_t laser_rate); // The step rate chosen below
+
       // Are we in acceleration phase ?
       if (step_events_completed <= accelerate_until) { // Calculate new timer value
 
@@ -2160,6 +2298,7 @@ uint32_t Stepper::block_phase_isr() {
         // step_rate to timer interval and steps per stepper isr
         interval = calc_timer_interval(acc_step_rate << oversampling_factor, steps_per_isr);
         acceleration_time += interval;
+        TERN_(LASER_POWER_VELOCITY, laser_rate = acc_step_rate);
 
         #if ENABLED(LIN_ADVANCE)
           if (current_block->la_advance_rate) {
@@ -2230,6 +2369,7 @@ uint32_t Stepper::block_phase_isr() {
         // step_rate to timer interval and steps per stepper isr
         interval = calc_timer_interval(step_rate << oversampling_factor, steps_per_isr);
         deceleration_time += interval;
+        TERN_(LASER_POWER_VELOCITY, laser_rate = step_rate);
 
         #if ENABLED(LIN_ADVANCE)
           if (current_block->la_advance_rate) {
@@ -2298,8 +2438,19 @@ uint32_t Stepper::block_phase_isr() {
 
         // The timer interval is just the nominal value for the nominal speed
         interval = ticks_nominal;
+        TERN_(LASER_POWER_VELOCITY, laser_rate = current_block->nominal_rate);
       }
 
+      /**
+       * Adjust Laser Power - Velocity
+       * Scale the block power by the step rate that times these steps, so the
+       * power follows trapezoid and S-curve speed changes alike.
+       */
+      #if ENABLED(LASER_POWER_VELOCITY)
+        if (cutter.cutter_mode == CUTTER_MODE_CONTINUOUS && current_block->laser.status.isEnabled && current_block->laser.status.isPowered)
+          laser_velocity_power(laser_rate);
+      #endif
+
       /**
        * Adjust Laser Power - Cruise
        * power - direct or floor adjusted active laser power.
@@ -2510,6 +2661,18 @@ uint32_t Stepper::block_phase_isr() {
       advance_dividend = (current_block->steps << 1).asLong();
       advance_divisor = step_event_count << 1;
 
+      #if ENABLED(ARC_NATIVE_BLOCKS)
+        // Start tracing the arc from its first angle
+        if (current_block->is_arc()) {
+          const float da = current_block->arc.angle / step_event_count;
+          arc_rot.set(cos(da), sin(da));
+          arc_vec.set(cos(current_block->arc.start_angle), sin(current_block->arc.start_angle));
+          arc_events = 0;
+          arc_done.reset();
+          arc_dirs = current_block->direction_bits; // Input shaping may hold the block's direction bits
+        }
+      #endif
+
       #if ENABLED(INPUT_SHAPING_X)
         if (shaping_x.enabled) {
           const int64_t steps = TEST(current_block->direction_bits, X_AXIS) ? -int64_t(current_block->steps.x) : int64_t(current_block->steps.x);
@@ -2566,6 +2729,15 @@ uint32_t Stepper::block_phase_isr() {
 
       #if ENABLED(LASER_FEATURE)
         if (cutter.cutter_mode == CUTTER_MODE_CONTINUOUS) {           // Planner controls the laser
+          TERN_(LASER_POWER_VELOCITY, laser_velocity_start());
+          #if ENABLED(LASER_RASTER)
+            if (current_block->laser.raster_pixels && current_block->laser.status.isEnabled) {
+              planner.laser_inline.status.isSyncPower = false;
+              raster_start();                                         // Power follows the G7 pixels
+              TERN_(LASER_POWER_VELOCITY, if (current_block->laser.status.isPowered) laser_velocity_power(current_block->initial_rate));
+            }
+            else
+          #endif
           if (planner.laser_inline.status.isSyncPower)
             // If the previous block was a M3 sync power then skip the trap power init otherwise it will 0 the sync power.
             planner.laser_inline.status.isSyncPower = false;          // Clear the flag to process subsequent trap calc's.
@@ -2575,12 +2747,20 @@ uint32_t Stepper::block_phase_isr() {
               cutter.apply_power(current_block->laser.status.isPowered ? current_block->laser.trap_ramp_active_pwr : 0);
             #else
               TERN_(DEBUG_CUTTER_POWER, SERIAL_ECHO_MSG("InlinePwr:",current_block->laser.power));
-              cutter.apply_power(current_block->laser.status.isPowered ? current_block->laser.power : 0);
+              #if ENABLED(LASER_POWER_VELOCITY)
+                if (current_block->laser.status.isPowered)
+                  laser_velocity_power(current_block->initial_rate);
+                else
+              #endif
+                  cutter.apply_power(current_block->laser.status.isPowered ? current_block->laser.power : 0);
             #endif
           }
         }
       #endif // LASER_FEATURE
 
+      // An edge latched during an earlier block doesn't apply to this one
+      TERN_(ENDSTOP_EDGE_CAPTURE, discard_capture());
+
       // If the endstop is already pressed, endstop interrupts won't invoke
       // endstop_triggered and the move will grind. So check here for a
       // triggered endstop, which marks the block for discard on the next ISR.
@@ -3167,22 +3347,26 @@ void Stepper::set_axis_position(const AxisEnum a, const int32_t &v) {
 void Stepper::endstop_triggered(const AxisEnum axis) {
 
   const bool was_enabled = suspend();
+
+  // Prefer the step counts latched at the endstop edge, if any
+  const xyze_long_t &trig_position = TERN(ENDSTOP_EDGE_CAPTURE, capture_valid ? captured_position : count_position, count_position);
+
   endstops_trigsteps[axis] = (
     #if IS_CORE
       (axis == CORE_AXIS_2
-        ? CORESIGN(count_position[CORE_AXIS_1] - count_position[CORE_AXIS_2])
-        : count_position[CORE_AXIS_1] + count_position[CORE_AXIS_2]
+        ? CORESIGN(trig_position[CORE_AXIS_1] - trig_position[CORE_AXIS_2])
+        : trig_position[CORE_AXIS_1] + trig_position[CORE_AXIS_2]
       ) * double(0.5)
     #elif ENABLED(MARKFORGED_XY)
       axis == CORE_AXIS_1
-        ? count_position[CORE_AXIS_1] - count_position[CORE_AXIS_2]
-        : count_position[CORE_AXIS_2]
+        ? trig_position[CORE_AXIS_1] - trig_position[CORE_AXIS_2]
+        : trig_position[CORE_AXIS_2]
     #elif ENABLED(MARKFORGED_YX)
       axis == CORE_AXIS_1
-        ? count_position[CORE_AXIS_1]
-        : count_position[CORE_AXIS_2] - count_position[CORE_AXIS_1]
+        ? trig_position[CORE_AXIS_1]
+        : trig_position[CORE_AXIS_2] - trig_position[CORE_AXIS_1]
     #else // !IS_CORE
-      count_position[axis]
+      trig_position[axis]
     #endif
   );
 
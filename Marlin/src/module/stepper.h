@@ -589,6 +589,27 @@ class Stepper {
       static page_step_state_t page_step_state;
     #endif
 
+    #if ENABLED(ARC_NATIVE_BLOCKS)
+      static xy_float_t arc_vec,      // Head direction from the arc center (cos, sin)
+                        arc_rot;      // Rotation per step event (cos, sin)
+      static uint32_t arc_events;     // Step events taken along the arc
+      static xy_long_t arc_done;      // Motor steps taken along the arc
+      static axis_bits_t arc_dirs;    // Motor directions of the arc block
+    #endif
+
+    #if ENABLED(LASER_RASTER)
+      static uint8_t raster_index;    // Pixel of the G7 raster run now lit
+      static uint32_t raster_next,    // Step event that starts the next pixel
+                      raster_pitch;   // Whole step events per pixel
+      static uint8_t raster_rem;      // Step events left over per pixel ...
+      static uint16_t raster_err;     // ... and their running sum, spread over the run
+    #endif
+
+    #if ENABLED(LASER_POWER_VELOCITY)
+      static uint32_t laser_rate_inv;       // (1 << 30) / nominal_rate of the block
+      static int16_t laser_velocity_last;   // Last power applied, -1 to force an update
+    #endif
+
     static int32_t ticks_nominal;
     #if DISABLED(S_CURVE_ACCELERATION)
       static uint32_t acc_step_rate; // needed for deceleration start point
@@ -597,6 +618,11 @@ class Stepper {
     // Exact steps at which an endstop was triggered
     static xyz_long_t endstops_trigsteps;
 
+    #if ENABLED(ENDSTOP_EDGE_CAPTURE)
+      static xyze_long_t captured_position; // Step counts latched at the last endstop edge
+      static bool capture_valid;            // Latched counts belong to the current block
+    #endif
+
     // Positions of stepper motors, in step units
     static xyze_long_t count_position;
 
@@ -701,6 +727,18 @@ class Stepper {
     // Handle a triggered endstop
     static void endstop_triggered(const AxisEnum axis);
 
+    #if ENABLED(ENDSTOP_EDGE_CAPTURE)
+      // Latch the step counts at an endstop edge, ahead of debouncing.
+      // Pin-change interrupts can land mid-step, so hold off the stepper ISR for the copy.
+      FORCE_INLINE static void capture_position() {
+        const bool was_on = suspend();
+        captured_position = count_position;
+        capture_valid = true;
+        if (was_on) wake_up();
+      }
+      FORCE_INLINE static void discard_capture() { capture_valid = false; }
+    #endif
+
     // Triggered position of an axis in steps
     static int32_t triggered_position(const AxisEnum axis);
 
@@ -822,6 +860,20 @@ class Stepper {
       static int32_t _eval_bezier_curve(const uint32_t curr_step);
     #endif
 
+    #if ENABLED(ARC_NATIVE_BLOCKS)
+      static void arc_pulse_prep(xyze_bool_t &step_needed);
+    #endif
+
+    #if ENABLED(LASER_RASTER)
+      static void raster_start();
+      static void raster_advance();
+    #endif
+
+    #if ENABLED(LASER_POWER_VELOCITY)
+      static void laser_velocity_start();
+      static void laser_velocity_power(uint32_t rate);
+    #endif
+
     #if HAS_MOTOR_CURRENT_SPI || HAS_MOTOR_CURRENT_PWM
       static void digipot_init();
     #endif
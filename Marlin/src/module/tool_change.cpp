@@ -59,6 +59,13 @@
   #include "../lcd/marlinui.h"
 #endif
 
+#if ENABLED(TOOLCHANGE_PREHEAT)
+  #include "../gcode/queue.h"
+  #if ENABLED(SDSUPPORT)
+    #include "../sd/cardreader.h"
+  #endif
+#endif
+
 #if ENABLED(DUAL_X_CARRIAGE)
   #include "stepper.h"
 #endif
@@ -1090,6 +1097,121 @@ void fast_line_to_current(const AxisEnum fr_axis) { _line_to_current(fr_axis, 0.
 
 #endif // TOOLCHANGE_FILAMENT_SWAP
 
+#if ENABLED(TOOLCHANGE_PREHEAT)
+
+  static celsius_t toolchange_resume_temp[HOTENDS]; // Target of each hotend when it was last deselected
+  static Flags<HOTENDS> toolchange_preheated;       // Preheat already issued for the upcoming change
+
+  /**
+   * Heat an upcoming tool back to the temperature it had when it was put away.
+   * Only heats a tool that was turned off (unless TOOLCHANGE_PREHEAT_STANDBY)
+   * so a standby temperature set by the slicer for ooze control is kept.
+   * Raises the target at most once per deselection, so later M104/M109 commands
+   * and manual changes are left alone.
+   */
+  static void toolchange_preheat(const uint8_t tool) {
+    if (tool == active_extruder || tool >= HOTENDS || toolchange_preheated[tool]) return;
+    const celsius_t temp = toolchange_resume_temp[tool],
+                    target = thermalManager.degTargetHotend(tool);
+    if (temp > target && (target == 0 || ENABLED(TOOLCHANGE_PREHEAT_STANDBY))) {
+      toolchange_preheated.set(tool);
+      DEBUG_ECHOLNPGM("Preheat T", tool, " to ", temp);
+      thermalManager.setTargetHotend(temp, tool);
+    }
+  }
+
+  /**
+   * Get the tool selected by a "T<n>" command, or -1 for any other command
+   */
+  static int8_t toolchange_command_tool(const char *cmd) {
+    while (*cmd == ' ') cmd++;
+    // Skip the line number sent by hosts that use checksums
+    if (*cmd == 'N' && NUMERIC(cmd[1])) {
+      do cmd++; while (NUMERIC(*cmd));
+      while (*cmd == ' ') cmd++;
+    }
+    if (*cmd++ != 'T' || !NUMERIC(*cmd)) return -1;
+    const int t = atoi(cmd);
+    return t < EXTRUDERS ? t : -1;
+  }
+
+  #if ENABLED(SDSUPPORT)
+
+    /**
+     * Read ahead in the SD print file through an independent file cursor,
+     * looking for T commands within TOOLCHANGE_PREHEAT_LOOKAHEAD bytes of
+     * the current print position. Reads at most one block per call. Whole
+     * aligned blocks bypass the volume cache, so the print file's cached
+     * block isn't evicted. Compressed files can't be scanned this way, so
+     * they only get the command queue lookahead.
+     */
+    static void toolchange_scan_sd() {
+      static SdFile cursor;
+      static uint8_t buf[512];
+      static uint32_t cursor_pos, last_sdpos;
+      static bool scanning, line_start;
+      static uint8_t tool;  // Tool number being parsed
+      static int8_t digits; // Digits seen after "T", -1 if not parsing a T command, -2 in a line number
+
+      if (!card.isPrinting() || TERN0(SDCARD_COMPRESSED_PRINT, card.flag.compressed)) { scanning = false; return; }
+
+      // (Re)start the scan at the print position for a new file or a jump
+      const uint32_t sdpos = card.getIndex();
+      if (!scanning || sdpos < last_sdpos || cursor_pos < sdpos) {
+        cursor = card.cloneFile();
+        cursor_pos = cursor.curPosition();
+        line_start = true;
+        digits = -1;
+        scanning = true;
+      }
+      last_sdpos = sdpos;
+
+      // Read up to the next block boundary, if within the lookahead window
+      const uint16_t n = 512 - (cursor_pos & 0x1FF);
+      if (cursor_pos + n > sdpos + (TOOLCHANGE_PREHEAT_LOOKAHEAD)) return;
+      const int16_t got = cursor.read(buf, n);
+      if (got <= 0) return;
+      cursor_pos += got;
+
+      for (int16_t i = 0; i < got; ++i) {
+        const char c = buf[i];
+        if (c == '\n' || c == '\r' || c == ';' || c == '*' || c == ' ') {
+          if (digits > 0 && tool < EXTRUDERS) toolchange_preheat(tool);
+          // The command word follows leading spaces and a line number
+          line_start = (c == '\n' || c == '\r' || (c == ' ' && (line_start || digits == -2)));
+          digits = -1;
+        }
+        else if (line_start) {
+          line_start = false;
+          if (c == 'T') { tool = 0; digits = 0; }
+          else if (c == 'N') digits = -2;
+        }
+        else if (digits >= 0) {
+          if (NUMERIC(c) && digits < 2) { tool = tool * 10 + (c - '0'); digits++; }
+          else digits = -1;
+        }
+        else if (digits == -2 && !NUMERIC(c))
+          digits = -1;
+      }
+    }
+
+  #endif // SDSUPPORT
+
+  /**
+   * Look ahead in the command queue and SD file for the next tool-change,
+   * preheating that tool while the current one finishes its moves.
+   * Called from idle().
+   */
+  void toolchange_preheat_lookahead() {
+    for (uint8_t i = 0, r = queue.ring_buffer.index_r; i < queue.ring_buffer.length; ++i, r = (r + 1) % BUFSIZE) {
+      const int8_t t = toolchange_command_tool(queue.ring_buffer.commands[r].buffer);
+      if (t >= 0) toolchange_preheat(t);
+    }
+    TERN_(SDSUPPORT, toolchange_scan_sd());
+  }
+
+#endif // TOOLCHANGE_PREHEAT
+
 /**
  * Perform a tool-change, which may result in moving the
  * previous tool out of the way and the new tool into place.
@@ -1173,6 +1295,14 @@ void tool_change(const uint8_t new_tool, bool no_move/*=false*/) {
     if (new_tool != old_tool || TERN0(PARKING_EXTRUDER, extruder_parked)) { // PARKING_EXTRUDER may need to attach old_tool when homing
       destination = current_position;
 
+      #if ENABLED(TOOLCHANGE_PREHEAT)
+        // Remember the outgoing tool's temperature to preheat it before it's needed again
+        if (old_tool < HOTENDS && new_tool != old_tool) {
+          toolchange_resume_temp[old_tool] = thermalManager.degTargetHotend(old_tool);
+          toolchange_preheated.clear(old_tool);
+        }
+      #endif
+
       #if BOTH(TOOLCHANGE_FILAMENT_SWAP, HAS_FAN) && TOOLCHANGE_FS_FAN >= 0
         // Store and stop fan. Restored on any exit.
         REMEMBER(fan, thermalManager.fan_speed[TOOLCHANGE_FS_FAN], 0);
@@ -60,6 +60,10 @@
     extern Flags<EXTRUDERS> toolchange_extruder_ready;
   #endif
 
+  #if ENABLED(TOOLCHANGE_PREHEAT)
+    void toolchange_preheat_lookahead();
+  #endif
+
   #if ENABLED(TOOLCHANGE_MIGRATION_FEATURE)
     typedef struct {
       uint8_t target, last;
@@ -2188,11 +2188,18 @@ int16_t SdBaseFile::write(const void *buf, uint16_t nbyte) {
     uint32_t block = vol_->clusterStartBlock(curCluster_) + blockOfCluster;
     if (n == 512) {
       // full block - don't need to use cache
-      if (vol_->cacheBlockNumber() == block) {
+      #if ENABLED(SD_MULTIBLOCK_WRITE)
+        // also take the rest of the full blocks in this cluster, for one multi-block write
+        const uint8_t nb = _MIN(nToWrite >> 9, vol_->blocksPerCluster() - blockOfCluster);
+        n = uint16_t(nb) << 9;
+      #else
+        constexpr uint8_t nb = 1;
+      #endif
+      if (vol_->cacheBlockNumber() - block < nb) {
         // invalidate cache if block is in cache
         vol_->cacheSetBlockNumber(0xFFFFFFFF, false);
       }
-      if (!vol_->writeBlock(block, src)) goto FAIL;
+      if (!TERN(SD_MULTIBLOCK_WRITE, vol_->writeBlocks(block, src, nb), vol_->writeBlock(block, src))) goto FAIL;
     }
     else {
       if (blockOffset == 0 && curPosition_ >= fileSize_) {
@@ -198,4 +198,21 @@ class SdVolume {
   }
   bool readBlock(uint32_t block, uint8_t *dst) { return sdCard_->readBlock(block, dst); }
   bool writeBlock(uint32_t block, const uint8_t *dst) { return sdCard_->writeBlock(block, dst); }
+  #if ENABLED(SD_MULTIBLOCK_WRITE)
+    // Write consecutive blocks with one pre-erased multi-block command
+    bool writeBlocks(uint32_t block, const uint8_t *src, const uint8_t count) {
+      #if IS_TEENSY_35_36 || IS_TEENSY_40_41
+        // The built-in SDHC slot only has single-block writes
+        for (uint8_t i = 0; i < count; i++, src += 512)
+          if (!writeBlock(block + i, src)) return false;
+        return true;
+      #else
+        if (count == 1) return writeBlock(block, src);
+        if (!sdCard_->writeStart(block, count)) return false;
+        for (uint8_t i = 0; i < count; i++, src += 512)
+          if (!sdCard_->writeData(src)) { sdCard_->writeStop(); return false; }
+        return sdCard_->writeStop();
+      #endif
+    }
+  #endif
 };
@@ -57,6 +57,10 @@
 #endif
 
 #define DEBUG_OUT EITHER(DEBUG_CARDREADER, MARLIN_DEV_MODE)
+#if HAS_DIR_STAMP
+  #include "../libs/crc16.h"
+#endif
+
 #include "../core/debug_out.h"
 #include "../libs/hex_print.h"
 
@@ -82,6 +86,11 @@ IF_DISABLED(NO_SD_AUTOSTART, uint8_t CardReader::autofile_index); // = 0
 SdFile CardReader::root, CardReader::workDir, CardReader::workDirParents[MAX_DIR_DEPTH];
 uint8_t CardReader::workDirDepth;
 
+#if ENABLED(M20_PAGED_LISTING)
+  uint16_t CardReader::ls_skip, CardReader::ls_left;
+  bool CardReader::ls_more;
+#endif
+
 #if ENABLED(SDCARD_SORT_ALPHA)
 
   uint16_t CardReader::sort_count;
@@ -122,6 +131,43 @@ uint8_t CardReader::workDirDepth;
 
   #endif // SDSORT_USES_RAM
 
+  #if ENABLED(SDSORT_BACKGROUND)
+    bool CardReader::sort_done = true;
+    uint32_t CardReader::sort_dirpos;
+    uint16_t CardReader::sort_entry[SDSORT_LIMIT];
+    char CardReader::sort_key[SDSORT_LIMIT][SDSORT_KEY_LEN];
+    uint8_t CardReader::sort_isdir[(SDSORT_LIMIT + 7) >> 3];
+  #endif
+
+  #if ENABLED(SDSORT_FILE_INDEX)
+
+    #define FILE_INDEX_NAME    "MARLIN.IDX"   // Not a listed type, so it never shows up in menus
+    #define FILE_INDEX_MAGIC   0x31584449UL   // "IDX1"
+
+    typedef struct {
+      uint32_t magic;                         // Zero until the index is complete
+      uint16_t rec_size, sort_limit;
+      int8_t sort_folders;
+      uint8_t key_len;
+      dir_stamp_t stamp;                      // Directory state when it was indexed
+      uint16_t count;                         // Number of records that follow
+    } file_index_head_t;
+
+    // One record per item, in display order
+    typedef struct {
+      uint32_t size;
+      uint8_t flags;                          // Bit 0: Folder, Bit 1: Binary
+      char dosname[FILENAME_LENGTH],
+           longname[LONG_FILENAME_LENGTH];
+    } file_index_rec_t;
+
+    CardReader::IndexState CardReader::index_state; // = INDEX_NONE
+    SdFile CardReader::indexFile;
+    uint16_t CardReader::index_count;
+    dir_stamp_t CardReader::index_stamp;
+
+  #endif
+
 #endif // SDCARD_SORT_ALPHA
 
 #if HAS_USB_FLASH_DRIVE
@@ -144,6 +190,18 @@ SdFile CardReader::file;
 
 uint32_t CardReader::filesize, CardReader::sdpos;
 
+#if ENABLED(SDCARD_COMPRESSED_PRINT)
+  heatshrink_decoder CardReader::hs_decoder;
+  uint8_t CardReader::hs_in[64], CardReader::hs_out[128],
+          CardReader::hs_in_pos, CardReader::hs_in_len, CardReader::hs_out_pos, CardReader::hs_out_len;
+  bool CardReader::hs_finished;
+#endif
+
+#if ENABLED(SD_MULTIBLOCK_WRITE)
+  __attribute__((aligned(sizeof(size_t)))) uint8_t CardReader::write_buffer[SD_WRITE_BUFFER_BLOCKS * 512];
+  uint16_t CardReader::write_count; // = 0
+#endif
+
 CardReader::CardReader() {
   changeMedia(&
     #if HAS_USB_FLASH_DRIVE && !SHARED_VOLUME_IS(SD_ONBOARD)
@@ -222,6 +280,11 @@ bool CardReader::is_visible_entity(const dir_t &p OPTARG(CUSTOM_FIRMWARE_UPLOAD,
     || fileIsBinary()                                   // BIN files are accepted
     || (!onlyBin && p.name[8] == 'G'
                  && p.name[9] != '~')                   // Non-backup *.G* files are accepted
+    #if ENABLED(SDCARD_COMPRESSED_PRINT)
+      || (!onlyBin && p.name[8] == 'H'
+                   && p.name[9] == 'S'
+                   && p.name[10] == ' ')                // Compressed *.HS files are accepted
+    #endif
   );
 }
 
@@ -241,6 +304,30 @@ int CardReader::countItems(SdFile dir) {
   return c;
 }
 
+#if HAS_DIR_STAMP
+
+  /**
+   * Stamp a directory listing with its first cluster and a CRC of the raw
+   * entries that can be listed, plus all long name entries. Access dates are
+   * ignored. This reads each directory block once, without the long name
+   * parsing of a regular listing.
+   */
+  void CardReader::dir_stamp(SdFile dir, dir_stamp_t &st) {
+    st.cluster = dir.firstCluster();
+    st.entries = st.crc = 0;
+    dir.rewind();
+    dir_t p;
+    while (dir.read(&p, sizeof(p)) == sizeof(p) && p.name[0] != DIR_NAME_FREE) {
+      if (p.name[0] == DIR_NAME_DELETED) continue;
+      if (!DIR_IS_LONG_NAME(&p) && !is_visible_entity(p)) continue;
+      if (!DIR_IS_LONG_NAME(&p)) p.lastAccessDate = 0;
+      crc16(&st.crc, &p, sizeof(p));
+      st.entries++;
+    }
+  }
+
+#endif
+
 //
 // Get file/folder info for an item by index
 //
@@ -290,9 +377,16 @@ void CardReader::printListing(SdFile parent,  const char * const prepend, const
   #if ENABLED(CUSTOM_FIRMWARE_UPLOAD)
     const bool onlyBin = TEST(lsflags, LS_ONLY_BIN);
   #endif
+  #if ENABLED(M20_PAGED_LISTING)
+    // Compact listings name the folder once, before its first file
+    const bool compact = TEST(lsflags, LS_COMPACT);
+    bool headed = !compact;
+  #else
+    constexpr bool compact = false;
+  #endif
   UNUSED(lsflags);
   dir_t p;
-  while (parent.readDir(&p, longFilename) > 0) {
+  while (TERN1(M20_PAGED_LISTING, !ls_more) && parent.readDir(&p, longFilename) > 0) {
     if (DIR_IS_SUBDIR(&p)) {
 
       size_t lenPrepend = prepend ? strlen(prepend) + 1 : 0;
@@ -314,10 +408,12 @@ void CardReader::printListing(SdFile parent,  const char * const prepend, const
             if (prependLong) { strcpy(pathLong, prependLong); pathLong[lenPrependLong - 1] = '/'; }
             strcpy(pathLong + lenPrependLong, longFilename);
             printListing(child, path, lsflags, pathLong);
+            TERN_(M20_PAGED_LISTING, headed = !compact);
             continue;
           }
         #endif
         printListing(child, path, lsflags);
+        TERN_(M20_PAGED_LISTING, headed = !compact);
       }
       else {
         SERIAL_ECHO_MSG(STR_SD_CANT_OPEN_SUBDIR, dosFilename);
@@ -325,7 +421,29 @@ void CardReader::printListing(SdFile parent,  const char * const prepend, const
       }
     }
     else if (is_visible_entity(p OPTARG(CUSTOM_FIRMWARE_UPLOAD, onlyBin))) {
-      if (prepend) { SERIAL_ECHO(prepend); SERIAL_CHAR('/'); }
+      #if ENABLED(M20_PAGED_LISTING)
+        if (ls_skip) { ls_skip--; continue; }
+        if (!ls_left) { ls_more = true; return; }
+        ls_left--;
+        if (!headed) {
+          // "<path>/ <token>" for the folder
+          headed = true;
+          if (prepend) SERIAL_ECHO(prepend);
+          SERIAL_CHAR('/', ' ');
+          dir_stamp_t st;
+          dir_stamp(parent, st);
+          SERIAL_ECHO(stamp_token(st));
+          #if ENABLED(LONG_FILENAME_HOST_SUPPORT)
+            if (includeLong) {
+              SERIAL_CHAR(' ');
+              if (prependLong) SERIAL_ECHO(prependLong);
+              SERIAL_CHAR('/');
+            }
+          #endif
+          SERIAL_EOL();
+        }
+      #endif
+      if (prepend && !compact) { SERIAL_ECHO(prepend); SERIAL_CHAR('/'); }
       SERIAL_ECHO(createFilename(filename, p));
       SERIAL_CHAR(' ');
       SERIAL_ECHO(p.fileSize);
@@ -342,7 +460,7 @@ void CardReader::printListing(SdFile parent,  const char * const prepend, const
       #if ENABLED(LONG_FILENAME_HOST_SUPPORT)
         if (includeLong) {
           SERIAL_CHAR(' ');
-          if (prependLong) { SERIAL_ECHO(prependLong); SERIAL_CHAR('/'); }
+          if (prependLong && !compact) { SERIAL_ECHO(prependLong); SERIAL_CHAR('/'); }
           SERIAL_ECHO(longFilename[0] ? longFilename : filename);
         }
       #endif
@@ -354,13 +472,56 @@ void CardReader::printListing(SdFile parent,  const char * const prepend, const
 //
 // List all files on the SD card
 //
-void CardReader::ls(const uint8_t lsflags) {
+void CardReader::ls(const uint8_t lsflags OPTARG(M20_PAGED_LISTING, const uint16_t offset/*=0*/, const uint16_t count/*=0*/)) {
   if (flag.mounted) {
+    #if ENABLED(M20_PAGED_LISTING)
+      ls_skip = offset;
+      ls_left = count ?: UINT16_MAX;
+      ls_more = false;
+    #endif
     root.rewind();
     printListing(root, nullptr, lsflags);
   }
 }
 
+#if ENABLED(M20_PAGED_LISTING)
+
+  uint32_t CardReader::stamp_token(const dir_stamp_t &st) {
+    uint16_t crc = 0;
+    crc16(&crc, &st, sizeof(st));
+    return (uint32_t(st.entries) << 16) | crc;
+  }
+
+  // Fold the stamps of a folder and all its subfolders into one
+  void CardReader::tree_token(SdFile dir, dir_stamp_t &acc) {
+    dir_stamp_t st;
+    dir_stamp(dir, st);
+    crc16(&acc.crc, &st, sizeof(st));
+    acc.entries += st.entries;
+
+    dir.rewind();
+    dir_t p;
+    while (dir.readDir(&p, nullptr) > 0) {
+      if (!DIR_IS_SUBDIR(&p)) continue;
+      char dosFilename[FILENAME_LENGTH];
+      SdFile child; // child.close() in destructor
+      if (child.open(&dir, createFilename(dosFilename, p), O_READ)) tree_token(child, acc);
+    }
+  }
+
+  /**
+   * A token for the whole listing, so hosts can skip unchanged cards.
+   * Only raw directory blocks are read, and nothing is printed.
+   */
+  uint32_t CardReader::listingToken() {
+    if (!flag.mounted) return 0;
+    dir_stamp_t acc{0};
+    tree_token(root, acc);
+    return stamp_token(acc);
+  }
+
+#endif // M20_PAGED_LISTING
+
 #if ENABLED(LONG_FILENAME_HOST_SUPPORT)
 
   //
@@ -692,6 +853,12 @@ void CardReader::openFileRead(const char * const path, const uint8_t subcall_typ
     filesize = file.fileSize();
     sdpos = 0;
 
+    #if ENABLED(SDCARD_COMPRESSED_PRINT)
+      dir_t d;
+      flag.compressed = file.dirEntry(&d) && d.name[8] == 'H' && d.name[9] == 'S' && d.name[10] == ' ';
+      if (flag.compressed) hs_rewind();
+    #endif
+
     { // Don't remove this block, as the PORT_REDIRECT is a RAII
       PORT_REDIRECT(SerialMask::All);
       SERIAL_ECHOLNPGM(STR_SD_FILE_OPENED, fname, STR_SD_SIZE, filesize);
@@ -727,6 +894,7 @@ void CardReader::openFileWrite(const char * const path) {
   #if DISABLED(SDCARD_READONLY)
     if (file.open(diveDir, fname, O_CREAT | O_APPEND | O_WRITE | O_TRUNC)) {
       flag.saving = true;
+      TERN_(SD_MULTIBLOCK_WRITE, write_count = 0);
       selectFileByName(fname);
       TERN_(EMERGENCY_PARSER, emergency_parser.disable());
       echo_write_to_file(fname);
@@ -791,7 +959,7 @@ void CardReader::removeFile(const char * const name) {
 
 void CardReader::report_status() {
   if (isPrinting() || isPaused()) {
-    SERIAL_ECHOPGM(STR_SD_PRINTING_BYTE, sdpos);
+    SERIAL_ECHOPGM(STR_SD_PRINTING_BYTE, mediaIndex());
     SERIAL_CHAR('/');
     SERIAL_ECHOLN(filesize);
   }
@@ -812,7 +980,11 @@ void CardReader::write_command(char * const buf) {
   end[1] = '\r';
   end[2] = '\n';
   end[3] = '\0';
-  file.write(begin);
+  #if ENABLED(SD_MULTIBLOCK_WRITE)
+    write(begin, end + 3 - begin);
+  #else
+    file.write(begin);
+  #endif
 
   if (file.writeError) SERIAL_ERROR_MSG(STR_SD_ERR_WRITE_TO_FILE);
 }
@@ -860,10 +1032,105 @@ void CardReader::write_command(char * const buf) {
   }
 #endif
 
+#if ENABLED(SDCARD_COMPRESSED_PRINT)
+
+  /**
+   * Decode more of a compressed file into hs_out, feeding the decoder
+   * from the file as needed. Return false at the end of the data.
+   */
+  bool CardReader::hs_fill() {
+    hs_out_pos = hs_out_len = 0;
+    for (;;) {
+      size_t count;
+      const HSD_poll_res pres = heatshrink_decoder_poll(&hs_decoder, hs_out, sizeof(hs_out), &count);
+      hs_out_len = count;
+      if (count) return true;
+      if (pres < 0 || hs_finished) return false;
+
+      // The decoder needs more input
+      if (hs_in_pos >= hs_in_len) {
+        const int16_t n = file.read(hs_in, sizeof(hs_in));
+        if (n <= 0) {
+          // No more input, so drain whatever the decoder still holds
+          hs_finished = heatshrink_decoder_finish(&hs_decoder) != HSDR_FINISH_MORE;
+          continue;
+        }
+        hs_in_pos = 0;
+        hs_in_len = n;
+      }
+      heatshrink_decoder_sink(&hs_decoder, &hs_in[hs_in_pos], hs_in_len - hs_in_pos, &count);
+      hs_in_pos += count;
+    }
+  }
+
+  void CardReader::hs_rewind() {
+    file.rewind();
+    heatshrink_decoder_reset(&hs_decoder);
+    hs_in_pos = hs_in_len = hs_out_pos = hs_out_len = 0;
+    hs_finished = false;
+    sdpos = 0;
+  }
+
+  /**
+   * Seek to a position in the decompressed data. The data can only be
+   * decoded forward, so going back further than the current output
+   * buffer starts over from the beginning of the file.
+   */
+  void CardReader::hs_seek(const uint32_t index) {
+    if (index < sdpos) {
+      if (sdpos - index <= hs_out_pos) {
+        hs_out_pos -= sdpos - index;
+        sdpos = index;
+        return;
+      }
+      hs_rewind();
+    }
+    while (sdpos < index && hs_ready()) {
+      const uint8_t n = _MIN(index - sdpos, uint32_t(hs_out_len - hs_out_pos));
+      hs_out_pos += n;
+      sdpos += n;
+    }
+  }
+
+#endif
+
+#if ENABLED(SD_MULTIBLOCK_WRITE)
+
+  /**
+   * Add data to the write buffer, writing it out whenever it fills.
+   * The file starts block-aligned and the buffer is whole blocks, so
+   * each flush streams straight to the media without the block cache.
+   */
+  int16_t CardReader::write(const void *buf, uint16_t nbyte) {
+    if (!file.isOpen()) return -1;
+    const uint8_t *src = (const uint8_t*)buf;
+    for (uint16_t left = nbyte; left;) {
+      const uint16_t n = _MIN(left, sizeof(write_buffer) - write_count);
+      memcpy(&write_buffer[write_count], src, n);
+      write_count += n;
+      src += n;
+      left -= n;
+      if (write_count == sizeof(write_buffer) && !write_flush()) return -1;
+    }
+    return nbyte;
+  }
+
+  bool CardReader::write_flush() {
+    const uint16_t n = write_count;
+    write_count = 0;
+    return !n || file.write(write_buffer, n) == int16_t(n);
+  }
+
+#endif
+
 void CardReader::closefile(const bool store_location/*=false*/) {
+  TERN_(SD_MULTIBLOCK_WRITE, if (flag.saving && !write_flush()) SERIAL_ERROR_MSG(STR_SD_ERR_WRITE_TO_FILE));
   file.sync();
   file.close();
+  // A new or changed file calls for a fresh listing
+  TERN_(SDSORT_FILE_INDEX, if (flag.saving) presort());
   flag.saving = flag.logging = false;
+  TERN_(SDCARD_COMPRESSED_PRINT, flag.compressed = false);
   sdpos = 0;
   TERN_(EMERGENCY_PARSER, emergency_parser.enable());
 
@@ -1053,6 +1320,21 @@ void CardReader::cdroot() {
    * Get the name of a file in the working directory by sort-index
    */
   void CardReader::getfilename_sorted(const uint16_t nr) {
+    #if ENABLED(SDSORT_FILE_INDEX)
+      // A ready index has every item in display order
+      if (index_state == INDEX_READY && nr < index_count && index_select(nr)) return;
+    #endif
+    #if ENABLED(SDSORT_BACKGROUND)
+      // Indexed items are read straight from their directory entry
+      if (TERN1(SDSORT_GCODE, sort_alpha) && nr < sort_count) {
+        dir_t p;
+        workDir.seekSet(uint32_t(sort_entry[sort_order[nr]]) << 5);
+        if (workDir.readDir(&p, longFilename) > 0 && is_visible_entity(p)) {
+          createFilename(filename, p);
+          return;
+        }
+      }
+    #endif
     selectFileByIndex(TERN1(SDSORT_GCODE, sort_alpha) && (nr < sort_count)
       ? sort_order[nr] : nr);
   }
@@ -1102,6 +1384,17 @@ void CardReader::cdroot() {
     // Sorting may be turned off
     if (TERN0(SDSORT_GCODE, !sort_alpha)) return;
 
+  #if ENABLED(SDSORT_BACKGROUND)
+
+    // An up-to-date index file makes sorting unnecessary
+    if (TERN0(SDSORT_FILE_INDEX, index_open())) return;
+
+    // Index from the top of the directory on the following idle() calls
+    sort_dirpos = 0;
+    sort_done = false;
+
+  #else
+
     // If there are files, sort up to the limit
     uint16_t fileCnt = countFilesInWorkDir();
     if (fileCnt > 0) {
@@ -1259,8 +1552,212 @@ void CardReader::cdroot() {
 
       sort_count = fileCnt;
     }
+
+  #endif // !SDSORT_BACKGROUND
   }
 
+  #if ENABLED(SDSORT_BACKGROUND)
+
+    /**
+     * Sort order of two indexed items, given the full name of the first.
+     * Keys that tie without ending are settled by the full names, read from
+     * the card. Other ties keep the directory order.
+     */
+    int CardReader::sort_compare(const uint8_t a, const uint8_t b, const char * const name_a) {
+      #if HAS_FOLDER_SORTING
+        const int fs = TERN(SDSORT_GCODE, sort_folders, FOLDER_SORTING);
+        const bool da = TEST(sort_isdir[a >> 3], a & 0x07), db = TEST(sort_isdir[b >> 3], b & 0x07);
+        if (fs && da != db) return da ? fs : -fs;
+      #endif
+      int r = strncmp(sort_key[a], sort_key[b], SDSORT_KEY_LEN);
+      if (!r && !memchr(sort_key[a], '\0', SDSORT_KEY_LEN)) {
+        char lfn[LONG_FILENAME_LENGTH], sfn[FILENAME_LENGTH];
+        dir_t p;
+        workDir.seekSet(uint32_t(sort_entry[b]) << 5);
+        if (workDir.readDir(&p, lfn) > 0) r = strcasecmp(name_a, lfn[0] ? lfn : createFilename(sfn, p));
+      }
+      return r ? r : int(a) - int(b);
+    }
+
+    /**
+     * Index more of the working directory, for up to SDSORT_SLICE_MS.
+     *
+     * Each visible item gets a short case-folded key and the number of its
+     * directory entry, then a binary search inserts it into sort_order. The
+     * indexed items are always the leading items of the directory, so until
+     * indexing is done the menus show them sorted and the rest unsorted.
+     * Menus are redrawn whenever an item lands before others.
+     */
+    void CardReader::presort_idle() {
+      if (flag.saving) return;
+      if (!isMounted()) { sort_done = true; return; }
+      if (sort_done) {
+        // Write the index file once sorting is done
+        TERN_(SDSORT_FILE_INDEX, if (!flag.sdprinting) index_idle());
+        return;
+      }
+
+      // Keep the selected item's flags. Names go into local buffers.
+      const bool was_dir = flag.filenameIsDir, was_bin = fileIsBinary();
+      char lfn[LONG_FILENAME_LENGTH], sfn[FILENAME_LENGTH];
+
+      bool reordered = false;
+      workDir.seekSet(sort_dirpos);
+      const millis_t end_ms = millis() + SDSORT_SLICE_MS;
+      do {
+        const uint32_t entry_pos = workDir.curPosition();
+        dir_t p;
+        if (sort_count >= SDSORT_LIMIT || workDir.readDir(&p, lfn) <= 0) { sort_done = true; break; }
+        if (!is_visible_entity(p)) continue;
+        const uint32_t next_pos = workDir.curPosition();
+
+        const uint8_t item = sort_count;
+        sort_entry[item] = entry_pos >> 5;
+        SET_BIT_TO(sort_isdir[item >> 3], item & 0x07, flag.filenameIsDir);
+        const char * const name = lfn[0] ? lfn : createFilename(sfn, p);
+        LOOP_L_N(i, SDSORT_KEY_LEN) if (!(sort_key[item][i] = tolower(uint8_t(name[i])))) break;
+
+        uint16_t lo = 0, hi = sort_count;
+        while (lo < hi) {
+          const uint16_t mid = (lo + hi) >> 1;
+          if (sort_compare(item, sort_order[mid], name) < 0) hi = mid; else lo = mid + 1;
+        }
+        if (workDir.curPosition() != next_pos) workDir.seekSet(next_pos); // A full name was read
+        memmove(&sort_order[lo + 1], &sort_order[lo], sort_count - lo);
+        sort_order[lo] = item;
+        if (lo < sort_count) reordered = true;
+        sort_count++;
+
+      } while (PENDING(millis(), end_ms));
+      sort_dirpos = workDir.curPosition();
+
+      flag.filenameIsDir = was_dir;
+      setBinFlag(was_bin);
+
+      if (reordered || sort_done) ui.refresh();
+    }
+
+  #endif // SDSORT_BACKGROUND
+
+  #if ENABLED(SDSORT_FILE_INDEX)
+
+    /**
+     * Open the working directory's index file and check that it matches the
+     * directory and the sort options. If not, ask for a new one.
+     */
+    bool CardReader::index_open() {
+      dir_stamp(workDir, index_stamp);
+      if (indexFile.open(&workDir, FILE_INDEX_NAME, O_READ)) {
+        file_index_head_t head;
+        if (indexFile.read(&head, sizeof(head)) == sizeof(head)
+          && head.magic == FILE_INDEX_MAGIC
+          && head.rec_size == sizeof(file_index_rec_t)
+          && head.sort_limit == SDSORT_LIMIT
+          && head.sort_folders == TERN(SDSORT_GCODE, sort_folders, FOLDER_SORTING)
+          && head.key_len == SDSORT_KEY_LEN
+          && !memcmp(&head.stamp, &index_stamp, sizeof(index_stamp))
+          && indexFile.fileSize() == sizeof(head) + uint32_t(head.count) * sizeof(file_index_rec_t)
+        ) {
+          index_count = head.count;
+          index_state = INDEX_READY;
+          return true;
+        }
+        indexFile.close();
+      }
+      index_state = INDEX_WANTED;
+      return false;
+    }
+
+    void CardReader::index_close() {
+      if (indexFile.isOpen()) indexFile.close();
+      index_state = INDEX_NONE;
+    }
+
+    /**
+     * Write the index file, for up to SDSORT_SLICE_MS.
+     *
+     * Sorted items are written first, then any items past SDSORT_LIMIT in
+     * directory order. The header is written last so an interrupted index
+     * is never used.
+     */
+    void CardReader::index_idle() {
+      if (index_state == INDEX_WANTED) {
+        const file_index_head_t head{0};
+        if (indexFile.open(&workDir, FILE_INDEX_NAME, O_CREAT | O_TRUNC | O_RDWR)
+          && indexFile.write(&head, sizeof(head)) == sizeof(head)
+        ) {
+          index_count = 0;
+          index_state = INDEX_BUILD;
+        }
+        else
+          index_close();
+        return;
+      }
+
+      if (index_state != INDEX_BUILD) return;
+
+      const bool was_dir = flag.filenameIsDir, was_bin = fileIsBinary();
+
+      bool done = false, ok = true;
+      const millis_t end_ms = millis() + SDSORT_SLICE_MS;
+      do {
+        file_index_rec_t rec{0};
+        dir_t p;
+        const bool sorted = index_count < sort_count;
+        workDir.seekSet(sorted ? uint32_t(sort_entry[sort_order[index_count]]) << 5 : sort_dirpos);
+        int8_t r;
+        while ((r = workDir.readDir(&p, rec.longname)) > 0 && !is_visible_entity(p)) { /* skip */ }
+        if (!sorted) sort_dirpos = workDir.curPosition();
+        if (r <= 0) { done = true; ok = !sorted; break; }
+
+        rec.size = p.fileSize;
+        rec.flags = (flag.filenameIsDir ? _BV(0) : 0) | (fileIsBinary() ? _BV(1) : 0);
+        createFilename(rec.dosname, p);
+        if (indexFile.write(&rec, sizeof(rec)) != sizeof(rec)) { done = true; ok = false; break; }
+        index_count++;
+
+      } while (PENDING(millis(), end_ms));
+
+      if (done) {
+        // Only keep the index if the directory didn't change during the build
+        dir_stamp_t st;
+        dir_stamp(workDir, st);
+        ok = ok && !memcmp(&st, &index_stamp, sizeof(st));
+        if (ok) {
+          const file_index_head_t head = {
+            FILE_INDEX_MAGIC, sizeof(file_index_rec_t), SDSORT_LIMIT,
+            TERN(SDSORT_GCODE, sort_folders, FOLDER_SORTING), SDSORT_KEY_LEN,
+            index_stamp, index_count
+          };
+          ok = indexFile.seekSet(0) && indexFile.write(&head, sizeof(head)) == sizeof(head) && indexFile.sync();
+        }
+        if (ok)
+          index_state = INDEX_READY;
+        else
+          index_close();
+      }
+
+      flag.filenameIsDir = was_dir;
+      setBinFlag(was_bin);
+    }
+
+    /**
+     * Select an item in display order from the index file
+     */
+    bool CardReader::index_select(const uint16_t nr) {
+      file_index_rec_t rec;
+      if (!indexFile.seekSet(sizeof(file_index_head_t) + uint32_t(nr) * sizeof(rec))
+        || indexFile.read(&rec, sizeof(rec)) != sizeof(rec)
+      ) return false;
+      strcpy(filename, rec.dosname);
+      strcpy(longFilename, rec.longname);
+      flag.filenameIsDir = TEST(rec.flags, 0);
+      setBinFlag(TEST(rec.flags, 1));
+      return true;
+    }
+
+  #endif // SDSORT_FILE_INDEX
+
   void CardReader::flush_presort() {
     if (sort_count > 0) {
       #if ENABLED(SDSORT_DYNAMIC_RAM)
@@ -1276,6 +1773,8 @@ void CardReader::cdroot() {
       #endif
       sort_count = 0;
     }
+    TERN_(SDSORT_BACKGROUND, sort_done = true);
+    TERN_(SDSORT_FILE_INDEX, index_close());
   }
 
 #endif // SDCARD_SORT_ALPHA
@@ -1285,6 +1784,12 @@ uint16_t CardReader::get_num_Files() {
   return (
     #if ALL(SDCARD_SORT_ALPHA, SDSORT_USES_RAM, SDSORT_CACHE_NAMES)
       nrFiles // no need to access the SD card for filenames
+    #elif ENABLED(SDSORT_BACKGROUND)
+      // A finished index has the count, unless it stopped at the limit
+      #if ENABLED(SDSORT_FILE_INDEX)
+        index_state == INDEX_READY ? index_count :
+      #endif
+      (sort_done && WITHIN(sort_count, 1, SDSORT_LIMIT - 1)) ? sort_count : countFilesInWorkDir()
     #else
       countFilesInWorkDir()
     #endif
@@ -1333,6 +1838,31 @@ void CardReader::fileHasFinished() {
       echo_write_to_file(recovery.filename);
   }
 
+  #if ENABLED(POWER_LOSS_JOURNAL)
+
+    /**
+     * Get the first block of the job recovery journal, which must be a
+     * contiguous file of exactly 'size' bytes. With 'create' a missing or
+     * unsuitable file is replaced. Return 0 if there's no usable journal.
+     */
+    uint32_t CardReader::jobRecoveryJournal(const uint32_t size, const bool create) {
+      if (!isMounted() || recovery.file.isOpen()) return 0;
+      uint32_t bgn = 0, end;
+      if (recovery.file.open(&root, recovery.filename, O_READ)) {
+        if (recovery.file.fileSize() != size || !recovery.file.contiguousRange(&bgn, &end)) bgn = 0;
+        recovery.file.close();
+        if (!bgn && create) SdBaseFile::remove(&root, recovery.filename);
+      }
+      if (!bgn && create) {
+        if (!recovery.file.createContiguous(&root, recovery.filename, size) || !recovery.file.contiguousRange(&bgn, &end))
+          bgn = 0;
+        recovery.file.close();
+      }
+      return bgn;
+    }
+
+  #endif
+
   // Removing the job recovery file currently requires closing
   // the file being printed, so during SD printing the file should
   // be zeroed and written instead of deleted.
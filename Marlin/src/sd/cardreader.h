@@ -36,6 +36,10 @@ extern const char M23_STR[], M24_STR[];
   #endif
 #endif
 
+#if EITHER(SDSORT_FILE_INDEX, M20_PAGED_LISTING)
+  #define HAS_DIR_STAMP 1
+#endif
+
 #if ENABLED(SDCARD_RATHERRECENTFIRST) && DISABLED(SDCARD_SORT_ALPHA)
   #define SD_ORDER(N,C) ((C) - 1 - (N))
 #else
@@ -87,15 +91,31 @@ typedef struct {
        #if ENABLED(BINARY_FILE_TRANSFER)
          , binary_mode:1
        #endif
+       #if ENABLED(SDCARD_COMPRESSED_PRINT)
+         , compressed:1
+       #endif
     ;
 } card_flags_t;
 
-enum ListingFlags : uint8_t { LS_LONG_FILENAME, LS_ONLY_BIN, LS_TIMESTAMP };
+enum ListingFlags : uint8_t { LS_LONG_FILENAME, LS_ONLY_BIN, LS_TIMESTAMP, LS_COMPACT };
+
+#if HAS_DIR_STAMP
+  // Identifies the state of a directory's listing
+  typedef struct {
+    uint32_t cluster;   // First cluster of the directory
+    uint16_t entries,   // Number of entries that affect the listing
+             crc;       // CRC16 of those entries
+  } dir_stamp_t;
+#endif
 
 #if ENABLED(AUTO_REPORT_SD_STATUS)
   #include "../libs/autoreport.h"
 #endif
 
+#if ENABLED(SDCARD_COMPRESSED_PRINT)
+  #include "../libs/heatshrink/heatshrink_decoder.h"
+#endif
+
 class CardReader {
 public:
   static card_flags_t flag;                         // Flags (above)
@@ -178,13 +198,13 @@ public:
   #if HAS_PRINT_PROGRESS_PERMYRIAD
     static uint16_t permyriadDone() {
       if (flag.sdprintdone) return 10000;
-      if (isFileOpen() && filesize) return sdpos / ((filesize + 9999) / 10000);
+      if (isFileOpen() && filesize) return mediaIndex() / ((filesize + 9999) / 10000);
       return 0;
     }
   #endif
   static uint8_t percentDone() {
     if (flag.sdprintdone) return 100;
-    if (isFileOpen() && filesize) return sdpos / ((filesize + 99) / 100);
+    if (isFileOpen() && filesize) return mediaIndex() / ((filesize + 99) / 100);
     return 0;
   }
 
@@ -203,6 +223,9 @@ public:
   #if ENABLED(SDCARD_SORT_ALPHA)
     static void presort();
     static void getfilename_sorted(const uint16_t nr);
+    #if ENABLED(SDSORT_BACKGROUND)
+      static void presort_idle();   // Index and sort more of the working directory. Called from idle().
+    #endif
     #if ENABLED(SDSORT_GCODE)
       FORCE_INLINE static void setSortOn(bool b)        { sort_alpha   = b; presort(); }
       FORCE_INLINE static void setSortFolders(int i)    { sort_folders = i; presort(); }
@@ -212,12 +235,19 @@ public:
     FORCE_INLINE static void getfilename_sorted(const uint16_t nr) { selectFileByIndex(nr); }
   #endif
 
-  static void ls(const uint8_t lsflags);
+  static void ls(const uint8_t lsflags OPTARG(M20_PAGED_LISTING, const uint16_t offset=0, const uint16_t count=0));
+  #if ENABLED(M20_PAGED_LISTING)
+    static bool lsMore() { return ls_more; }  // Items remain after the last page
+    static uint32_t listingToken();           // Changes whenever any listed item changes
+  #endif
 
   #if ENABLED(POWER_LOSS_RECOVERY)
     static bool jobRecoverFileExists();
     static void openJobRecoveryFile(const bool read);
     static void removeJobRecoveryFile();
+    #if ENABLED(POWER_LOSS_JOURNAL)
+      static uint32_t jobRecoveryJournal(const uint32_t size, const bool create);
+    #endif
   #endif
 
   // Binary flag for the current file
@@ -232,13 +262,35 @@ public:
   static uint32_t getFileSize()  { return filesize; }
   static uint32_t getIndex()     { return sdpos; }
   static bool isFileOpen()       { return isMounted() && file.isOpen(); }
-  static bool eof()              { return getIndex() >= getFileSize(); }
+  static bool eof() {
+    #if ENABLED(SDCARD_COMPRESSED_PRINT)
+      if (flag.compressed) return !hs_ready();
+    #endif
+    return getIndex() >= getFileSize();
+  }
+  // Read position in the media file. Ahead of getIndex() for a compressed file.
+  static uint32_t mediaIndex()   { return TERN0(SDCARD_COMPRESSED_PRINT, flag.compressed) ? file.curPosition() : sdpos; }
+  static SdFile cloneFile()      { return file; } // An independent read cursor on the open file
 
   // File data operations
-  static int16_t get()                            { int16_t out = (int16_t)file.read(); sdpos = file.curPosition(); return out; }
+  static int16_t get() {
+    #if ENABLED(SDCARD_COMPRESSED_PRINT)
+      if (flag.compressed) return hs_ready() ? (++sdpos, hs_out[hs_out_pos++]) : -1;
+    #endif
+    int16_t out = (int16_t)file.read(); sdpos = file.curPosition(); return out;
+  }
   static int16_t read(void *buf, uint16_t nbyte)  { return file.isOpen() ? file.read(buf, nbyte) : -1; }
-  static int16_t write(void *buf, uint16_t nbyte) { return file.isOpen() ? file.write(buf, nbyte) : -1; }
-  static void setIndex(const uint32_t index)      { file.seekSet((sdpos = index)); }
+  #if ENABLED(SD_MULTIBLOCK_WRITE)
+    static int16_t write(const void *buf, uint16_t nbyte);
+  #else
+    static int16_t write(void *buf, uint16_t nbyte) { return file.isOpen() ? file.write(buf, nbyte) : -1; }
+  #endif
+  static void setIndex(const uint32_t index) {
+    #if ENABLED(SDCARD_COMPRESSED_PRINT)
+      if (flag.compressed) return hs_seek(index);
+    #endif
+    file.seekSet((sdpos = index));
+  }
 
   // TODO: rename to diskIODriver()
   static DiskIODriver* diskIODriver() { return driver; }
@@ -286,6 +338,27 @@ private:
       static uint8_t sort_order[SDSORT_LIMIT];
     #endif
 
+    #if ENABLED(SDSORT_BACKGROUND)
+      static bool sort_done;                            // The indexer has reached the end of the directory (or the limit)
+      static uint32_t sort_dirpos;                      // Directory position to resume indexing
+      static uint16_t sort_entry[SDSORT_LIMIT];         // Directory entry number of each item, for O(1) lookup
+      static char sort_key[SDSORT_LIMIT][SDSORT_KEY_LEN]; // Case-folded leading characters of each name
+      static uint8_t sort_isdir[(SDSORT_LIMIT + 7) >> 3];
+      static int sort_compare(const uint8_t a, const uint8_t b, const char * const name_a);
+    #endif
+
+    #if ENABLED(SDSORT_FILE_INDEX)
+      enum IndexState : uint8_t { INDEX_NONE, INDEX_WANTED, INDEX_BUILD, INDEX_READY };
+      static IndexState index_state;
+      static SdFile indexFile;          // The working directory's index file
+      static uint16_t index_count;      // Items in the index, or written so far
+      static dir_stamp_t index_stamp;   // Directory stamp taken by presort()
+      static bool index_open();
+      static void index_close();
+      static void index_idle();
+      static bool index_select(const uint16_t nr);
+    #endif
+
     #if BOTH(SDSORT_USES_RAM, SDSORT_CACHE_NAMES) && DISABLED(SDSORT_DYNAMIC_RAM)
       #define SORTED_LONGNAME_MAXLEN (SDSORT_CACHE_VFATS) * (FILENAME_LENGTH)
       #define SORTED_LONGNAME_STORAGE (SORTED_LONGNAME_MAXLEN + 1)
@@ -331,6 +404,25 @@ private:
   static uint32_t filesize, // Total size of the current file, in bytes
                   sdpos;    // Index most recently read (one behind file.getPos)
 
+  #if ENABLED(SDCARD_COMPRESSED_PRINT)
+    // Decoder for printing a heatshrink-compressed file. sdpos counts decompressed bytes.
+    static heatshrink_decoder hs_decoder;
+    static uint8_t hs_in[64], hs_out[128];
+    static uint8_t hs_in_pos, hs_in_len, hs_out_pos, hs_out_len;
+    static bool hs_finished;
+    static bool hs_fill();
+    static bool hs_ready() { return hs_out_pos < hs_out_len || hs_fill(); }
+    static void hs_rewind();
+    static void hs_seek(const uint32_t index);
+  #endif
+
+  #if ENABLED(SD_MULTIBLOCK_WRITE)
+    // Uploads collect here and go to the media in multi-block bursts
+    static uint8_t write_buffer[SD_WRITE_BUFFER_BLOCKS * 512];
+    static uint16_t write_count;
+    static bool write_flush();
+  #endif
+
   //
   // Procedure calls to other files
   //
@@ -351,6 +443,16 @@ private:
     OPTARG(LONG_FILENAME_HOST_SUPPORT, const char * const prependLong=nullptr)
   );
 
+  #if HAS_DIR_STAMP
+    static void dir_stamp(SdFile dir, dir_stamp_t &st);
+  #endif
+  #if ENABLED(M20_PAGED_LISTING)
+    static uint16_t ls_skip, ls_left;   // Items to skip and print
+    static bool ls_more;
+    static uint32_t stamp_token(const dir_stamp_t &st);
+    static void tree_token(SdFile dir, dir_stamp_t &st);
+  #endif
+
   #if ENABLED(SDCARD_SORT_ALPHA)
     static void flush_presort();
   #endif